@@ -0,0 +1,386 @@
+// Filename: CCPoissonHypreCompositeSolver.h
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef included_IBTK_CCPoissonHypreCompositeSolver
+#define included_IBTK_CCPoissonHypreCompositeSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "BoxArray.h"
+#include "CoarseFineBoundary.h"
+#include "CoarsenAlgorithm.h"
+#include "CoarsenOperator.h"
+#include "CoarsenSchedule.h"
+#include "HYPRE_parcsr_ls.h"
+#include "HYPRE_sstruct_ls.h"
+#include "HYPRE_sstruct_mv.h"
+#include "Index.h"
+#include "PatchHierarchy.h"
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+} // namespace hier
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CCPoissonHypreCompositeSolver is a concrete LinearSolver for
+ * solving elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I +
+ * \nabla \cdot D \nabla) u$} = f \f$ on a range of levels of a locally refined
+ * SAMRAI::hier::PatchHierarchy using the semi-structured (SStruct) interface of
+ * <A HREF="https://computation.llnl.gov/casc/linear_solvers/sls_hypre.html">hypre</A>.
+ *
+ * Each patch level is represented as a separate part of a single hypre SStruct
+ * grid, and the entire composite-grid system is assembled into one hypre
+ * matrix.  Cells that are covered by a finer level are decoupled from the
+ * system and are assigned the restriction of the fine-grid solution after each
+ * solve.  At coarse-fine interfaces, the ghost values of the fine cells are
+ * eliminated using the same quadratic coarse-fine interpolation scheme as
+ * CartCellDoubleQuadraticCFInterpolation, i.e., quadratic interpolation of the
+ * coarse values tangential to the interface followed by quadratic
+ * interpolation normal to the interface through the two adjacent fine cells.
+ * Where the centered tangential stencil includes coarse cells that are covered
+ * or that lie outside of the coarse level (e.g., near physical boundaries and
+ * at concave corners of the fine level), one-sided or lower-order stencils are
+ * used instead.  The flux through each coarse cell face along the interface is
+ * the average of the corresponding fine-grid fluxes, so that the
+ * discretization is conservative.  The equations are scaled by the cell
+ * volumes.  The assembled matrix is nonsymmetric.
+ *
+ * The composite-grid system is stored as a hypre ParCSR matrix and is solved
+ * either by BoomerAMG or by a hypre Krylov method that is preconditioned by a
+ * single BoomerAMG V-cycle.  The matrix and the algebraic multigrid hierarchy
+ * are constructed once by initializeSolverState(), i.e., once per regridding
+ * operation when the solver state is maintained between solves.
+ *
+ * \note This class is intended to be used as a preconditioner, e.g., for a
+ * PETScKrylovPoissonSolver.  Away from physical boundaries and the fine level
+ * corners where the interpolation stencils are modified, the assembled
+ * operator agrees with the composite-grid operator of CCLaplaceOperator, but
+ * the two are not identical, and the FAC preconditioners (e.g.,
+ * CCPoissonPointRelaxationFACOperator with PoissonFACPreconditioner) remain the
+ * reference solvers for the composite-grid problem.  Side-centered problems are
+ * not supported; see SCPoissonSolverManager.
+ *
+ * \note Only scalar diffusion coefficients \f$D\f$ are supported.  Because the
+ * assembled matrix is nonsymmetric, "PCG" should not be used, and a
+ * nonsymmetric Krylov method (e.g., "GMRES") is recommended.
+ *
+ * \note If the coarsest level of the solver is not level 0, the caller must
+ * provide coarse-fine interface ghost values for the coarsest level in the
+ * solution vector, as with class CCPoissonHypreLevelSolver.
+ *
+ * Robin boundary conditions may be specified through the interface class
+ * SAMRAI::solv::RobinBcCoefStrategy.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE         // see setLoggingEnabled()
+ solver_type = "BoomerAMG"      // choices are: "BoomerAMG", "PCG", "GMRES", "FlexGMRES",
+ "BiCGSTAB"
+ precond_type = "BoomerAMG"     // choices are: "BoomerAMG", "none" (only used by Krylov
+ solvers)
+ max_iterations = 25            // see setMaxIterations()
+ abs_residual_tol = 1.e-50      // see setAbsoluteTolerance() (only used by hypre Krylov
+ solvers)
+ rel_residual_tol = 1.0e-5      // see setRelativeTolerance()
+ initial_guess_nonzero = FALSE  // see setInitialGuessNonzero()
+ two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ k_dim = 30                     // see hypre User's Manual (only used by GMRES and FlexGMRES
+ solvers)
+ coarsen_type = 10              // see hypre User's Manual (only used by BoomerAMG)
+ relax_type = 6                 // see hypre User's Manual (only used by BoomerAMG)
+ num_sweeps = 1                 // see hypre User's Manual (only used by BoomerAMG)
+ strong_threshold = 0.25        // see hypre User's Manual (only used by BoomerAMG; the
+ default is 0.5 in 3D)
+ \endverbatim
+ */
+class CCPoissonHypreCompositeSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CCPoissonHypreCompositeSolver(const std::string& object_name,
+                                  SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                  const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CCPoissonHypreCompositeSolver();
+
+    /*!
+     * \brief Static function to construct a CCPoissonHypreCompositeSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new CCPoissonHypreCompositeSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * <b>Conditions on Parameters:</b>
+     * - vectors \a x and \a b must have same patch hierarchy
+     * - vectors \a x and \a b must have same structure, depth, etc.
+     *
+     * \note The solver need not be initialized prior to calling solveSystem();
+     * however, see initializeSolverState() and deallocateSolverState() for
+     * opportunities to save overhead when performing multiple consecutive
+     * solves.
+     *
+     * \see initializeSolverState
+     * \see deallocateSolverState
+     *
+     * \return \p true if the solver converged to the specified tolerances, \p
+     * false otherwise
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * The composite-grid matrix is assembled and the hypre solver is set up
+     * here.  It is necessary to reinitialize the solver state when the
+     * hierarchy configuration or the problem coefficients change.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * <b>Conditions on Parameters:</b>
+     * - vectors \a x and \a b must have same patch hierarchy
+     * - vectors \a x and \a b must have same structure, depth, etc.
+     *
+     * \note It is safe to call initializeSolverState() when the state is
+     * already initialized.  In this case, the solver state is first deallocated
+     * and then reinitialized.
+     *
+     * \see deallocateSolverState
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \note It is safe to call deallocateSolverState() when the solver state is
+     * already deallocated.
+     *
+     * \see initializeSolverState
+     */
+    void deallocateSolverState();
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CCPoissonHypreCompositeSolver();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CCPoissonHypreCompositeSolver(const CCPoissonHypreCompositeSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CCPoissonHypreCompositeSolver& operator=(const CCPoissonHypreCompositeSolver& that);
+
+    /*!
+     * \brief Coupling between a cell along a coarse-fine interface and a cell
+     * on the same level or on the next coarser or next finer level.
+     *
+     * The coupling coefficient is the product of \a wgt and the standard
+     * stencil coefficient \a stencil_index of the row, which is replaced by
+     * the coupling.  Couplings that may be represented by the standard stencil
+     * have nonnegative values of \a col_stencil_index.
+     */
+    struct CoarseFineCoupling
+    {
+        SAMRAI::hier::Index<NDIM> row_idx, col_idx;
+        int col_ln;
+        int stencil_index;
+        int col_stencil_index;
+        double wgt;
+    };
+
+    /*!
+     * \brief Determine the coarse-fine couplings of the cells of a patch.
+     *
+     * The couplings are sorted so that the couplings of each cell are
+     * contiguous, that couplings to the same column are adjacent, and that
+     * they appear in the same order every time that this function is called
+     * for a particular hierarchy configuration.
+     */
+    void getCoarseFineCouplings(std::vector<CoarseFineCoupling>& couplings,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                int ln) const;
+
+    /*!
+     * \brief Determine the nodes and weights of the quadratic coarse-fine
+     * interpolation scheme that determines the ghost value adjacent to fine
+     * cell \a i_fine in direction (\a axis, \a side).
+     *
+     * The ghost cell is contained in coarse cell \a i_coarse, and the indices
+     * of the coarse interpolation nodes are relative to \a i_coarse.
+     */
+    void getCoarseFineInterpolationStencil(std::vector<CoarseFineCoupling>& nodes,
+                                           const SAMRAI::hier::Index<NDIM>& i_fine,
+                                           const SAMRAI::hier::Index<NDIM>& i_coarse,
+                                           int fine_ln,
+                                           unsigned int axis,
+                                           int side) const;
+
+    /*!
+     * \brief Map an index of the specified level to its periodic image in the
+     * physical domain.
+     */
+    SAMRAI::hier::Index<NDIM> getPeriodicImage(const SAMRAI::hier::Index<NDIM>& i, int ln) const;
+
+    /*!
+     * \brief Determine whether a cell of the specified level may be used in
+     * coarse-fine interpolation, i.e., whether it belongs to the level and is
+     * not covered by the next finer level.
+     */
+    bool isValidInterpolationNode(const SAMRAI::hier::Index<NDIM>& i, int ln) const;
+
+    /*!
+     * \brief Determine whether a cell of the specified level is covered by the
+     * next finer level.
+     */
+    bool isCovered(const SAMRAI::hier::Index<NDIM>& i, int ln) const;
+
+    /*!
+     * \brief Functions to allocate, initialize, access, and deallocate hypre
+     * data structures.
+     */
+    void allocateHypreData();
+    void setMatrixCoefficients();
+    void setupHypreSolver();
+    bool solveSystem(int x_idx, int b_idx);
+    void destroyHypreSolver();
+    void deallocateHypreData();
+
+    /*!
+     * \brief Associated hierarchy.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*!
+     * \brief Associated range of patch levels, C-F boundaries (for level
+     * numbers > 0), and the coarsened boxes of the next finer levels.
+     */
+    int d_coarsest_ln, d_finest_ln;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::CoarseFineBoundary<NDIM> > > d_cf_boundary;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_covered_boxes;
+
+    /*!
+     * \brief Data for synchronizing the solution on covered cells.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenOperator<NDIM> > d_coarsen_op;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
+
+    /*!
+     * \name hypre objects.
+     */
+    //\{
+    unsigned int d_depth;
+    HYPRE_SStructGrid d_grid;
+    HYPRE_SStructStencil d_stencil;
+    HYPRE_SStructGraph d_graph;
+    std::vector<HYPRE_SStructMatrix> d_matrices;
+    std::vector<HYPRE_SStructVector> d_rhs_vecs, d_sol_vecs;
+    std::vector<HYPRE_Solver> d_solvers, d_preconds;
+    std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
+
+    std::string d_solver_type, d_precond_type;
+    int d_two_norm;
+    int d_k_dim;
+    int d_coarsen_type;
+    int d_relax_type;
+    int d_num_sweeps;
+    double d_strong_threshold;
+    //\}
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CCPoissonHypreCompositeSolver
@@ -73,12 +73,19 @@ public:
     static const std::string LEVEL_RELAXATION_FAC_PRECONDITIONER;
     static const std::string POINT_RELAXATION_FAC_PRECONDITIONER;
 
+    /*!
+     * Default composite-grid solver types automatically provided by the manager
+     * class.
+     */
+    static const std::string HYPRE_COMPOSITE_SOLVER;
+
     /*!
      * Default level solver types automatically provided by the manager class.
      */
     static const std::string DEFAULT_LEVEL_SOLVER;
     static const std::string HYPRE_LEVEL_SOLVER;
     static const std::string PETSC_LEVEL_SOLVER;
+    static const std::string FFT_LEVEL_SOLVER;
 
     /*!
      * Return a pointer to the instance of the solver manager.  Access to
@@ -35,11 +35,14 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "SAMRAIVectorReal.h"
+#include "ibtk/GeneralSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Pointer.h"
@@ -70,17 +73,47 @@ namespace IBTK
  * This class is similar to the SAMRAI class SAMRAI::solv::FACPreconditioner,
  * except that this class has been optimized for the case in which the solver is
  * to be used as a single-pass preconditioner, especially for the case in which
- * pre-smoothing sweeps are not needed.  This class is not suitable for use as a
- * stand-alone solver; rather, it is intended to be used in conjunction with an
- * iterative Krylov method.
+ * pre-smoothing sweeps are not needed.  By default, a single cycle is applied
+ * to a zero initial guess, so that the class is intended to be used in
+ * conjunction with an iterative Krylov method.
+ *
+ * When the maximum number of iterations is larger than one or the initial guess
+ * is nonzero, the class acts as a stand-alone solver that repeatedly applies
+ * cycles to the residual equation until the prescribed tolerances are met.  In
+ * this mode, \p FMG_CYCLE provides full multigrid (nested iteration) that
+ * yields an approximate solution after a single cycle.
+ *
+ * The \p K_CYCLE cycle type is a Krylov-accelerated cycle in which the coarse
+ * grid correction on each intermediate level is computed by up to two flexible
+ * conjugate gradient iterations that are preconditioned by the cycle on the
+ * next coarser level.  The second iteration is skipped when the first reduces
+ * the coarse residual by at least the factor \a k_cycle_tol.  The K-cycle
+ * requires that the strategy's level operators be symmetric and definite.
+ * Krylov acceleration is applied on every level above the coarsest level,
+ * including levels with coarse-fine interfaces, in which case the iterates are
+ * composite-grid corrections on that level and all coarser levels.
+ *
+ * \note Because the coefficients of the inner iterations depend on the residual,
+ * the K-cycle is a nonlinear preconditioner.  It must be used with a flexible
+ * Krylov method, such as FGMRES (e.g., \p ksp_type = \p "fgmres" for a
+ * PETScKrylovLinearSolver).
+ *
+ * The wall clock time spent on each level and the residual history of the most
+ * recent stand-alone solve are recorded; see printCycleStatistics() and
+ * getResidualHistory().
  *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
- cycle_type = "V_CYCLE"  // see setMGCycleType()
- num_pre_sweeps = 0      // see setNumPreSmoothingSweeps()
- num_post_sweeps = 2     // see setNumPostSmoothingSweeps()
- enable_logging = FALSE  // see setLoggingEnabled()
+ cycle_type = "V_CYCLE"         // see setMGCycleType()
+ num_pre_sweeps = 0             // see setNumPreSmoothingSweeps()
+ num_post_sweeps = 2            // see setNumPostSmoothingSweeps()
+ k_cycle_tol = 0.25             // see setKCycleTolerance()
+ max_iterations = 1             // see setMaxIterations()
+ rel_residual_tol = 1.0e-5      // see setRelativeTolerance()
+ abs_residual_tol = 1.0e-50     // see setAbsoluteTolerance()
+ initial_guess_nonzero = FALSE  // see setInitialGuessNonzero()
+ enable_logging = FALSE         // see setLoggingEnabled()
  \endverbatim
 */
 class FACPreconditioner : public LinearSolver
@@ -231,6 +264,9 @@ public:
 
     /*!
      * \brief Set the maximum number of iterations to use per solve.
+     *
+     * \note When more than one iteration is requested, the preconditioner acts
+     * as a stand-alone solver.
      */
     void setMaxIterations(int max_iterations);
 
@@ -266,6 +302,57 @@ public:
      */
     int getNumPostSmoothingSweeps() const;
 
+    /*!
+     * \brief Set the relative residual reduction below which the K-cycle skips
+     * its second coarse grid iteration.
+     */
+    void setKCycleTolerance(double k_cycle_tol);
+
+    /*!
+     * \brief Get the relative residual reduction below which the K-cycle skips
+     * its second coarse grid iteration.
+     */
+    double getKCycleTolerance() const;
+
+    //\}
+
+    /*!
+     * \name Performance statistics.
+     */
+    //\{
+
+    /*!
+     * \brief Get the residual norms computed during the most recent
+     * stand-alone solve, starting with the initial residual norm.
+     */
+    const std::vector<double>& getResidualHistory() const;
+
+    /*!
+     * \brief Print the number of cycles applied and the maximum (over all
+     * processors) wall clock time spent on each level since the last call to
+     * resetCycleStatistics().
+     *
+     * \note This is a collective operation.
+     */
+    void printCycleStatistics(std::ostream& os) const;
+
+    /*!
+     * \brief Reset the cycle counts and per-level timings.
+     */
+    void resetCycleStatistics();
+
+    /*!
+     * \brief Print and reset the cycle statistics of the FAC preconditioner
+     * employed by the specified solver, if any.
+     *
+     * The solver may either be a FACPreconditioner or a KrylovLinearSolver that
+     * is preconditioned by a FACPreconditioner.  Nothing is printed for other
+     * solvers.
+     *
+     * \note This is a collective operation.
+     */
+    static void logCycleStatistics(SAMRAI::tbox::Pointer<GeneralSolver> solver, std::ostream& os);
+
     //\}
 
     /*!
@@ -275,6 +362,12 @@ public:
     SAMRAI::tbox::Pointer<FACPreconditionerStrategy> getFACPreconditionerStrategy() const;
 
 protected:
+    void applyCycle(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f);
+
+    void computeCompositeResidual(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& r,
+                                  const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                                  const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f);
+
     void FACVCycleNoPreSmoothing(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
                                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
                                  int level_num);
@@ -293,6 +386,10 @@ protected:
                   int level_num,
                   int mu);
 
+    void KCycle(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
+                int level_num);
+
     SAMRAI::tbox::Pointer<FACPreconditionerStrategy> d_fac_strategy;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln;
@@ -301,6 +398,20 @@ protected:
     int d_num_pre_sweeps, d_num_post_sweeps;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f, d_r;
 
+    /*
+     * Data used by the stand-alone solver mode and by the K-cycle.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_res, d_err;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_k_c, d_k_v;
+    double d_k_cycle_tol;
+
+    /*
+     * Performance statistics.
+     */
+    std::vector<double> d_residual_history;
+    std::vector<double> d_level_time;
+    unsigned int d_num_cycles;
+
 private:
     /*!
      * \brief Default constructor.
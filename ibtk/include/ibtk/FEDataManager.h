@@ -54,8 +54,12 @@
 #include "boost/multi_array.hpp"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_base.h"
+#include "libmesh/fe_type.h"
+#include "petscsys.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
@@ -118,13 +122,19 @@ public:
                    const libMesh::Order& quad_order,
                    bool use_adaptive_quadrature,
                    double point_density,
-                   bool use_consistent_mass_matrix)
+                   bool use_consistent_mass_matrix,
+                   bool use_strain_indicator = false,
+                   double min_point_density = 1.0,
+                   double strain_threshold = 0.1)
             : kernel_fcn(kernel_fcn),
               quad_type(quad_type),
               quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature),
               point_density(point_density),
-              use_consistent_mass_matrix(use_consistent_mass_matrix)
+              use_consistent_mass_matrix(use_consistent_mass_matrix),
+              use_strain_indicator(use_strain_indicator),
+              min_point_density(min_point_density),
+              strain_threshold(strain_threshold)
         {
         }
 
@@ -134,6 +144,9 @@ public:
         bool use_adaptive_quadrature;
         double point_density;
         bool use_consistent_mass_matrix;
+        bool use_strain_indicator;
+        double min_point_density;
+        double strain_threshold;
     };
 
     /*!
@@ -151,12 +164,18 @@ public:
                    const libMesh::QuadratureType& quad_type,
                    const libMesh::Order& quad_order,
                    bool use_adaptive_quadrature,
-                   double point_density)
+                   double point_density,
+                   bool use_strain_indicator = false,
+                   double min_point_density = 1.0,
+                   double strain_threshold = 0.1)
             : kernel_fcn(kernel_fcn),
               quad_type(quad_type),
               quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature),
-              point_density(point_density)
+              point_density(point_density),
+              use_strain_indicator(use_strain_indicator),
+              min_point_density(min_point_density),
+              strain_threshold(strain_threshold)
         {
         }
 
@@ -165,6 +184,9 @@ public:
         libMesh::Order quad_order;
         bool use_adaptive_quadrature;
         double point_density;
+        bool use_strain_indicator;
+        double min_point_density;
+        double strain_threshold;
     };
 
     /*!
@@ -302,6 +324,22 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Repartition the FE mesh so that each active element is owned by
+     * the MPI process that owns the Cartesian grid patch on the FE data
+     * manager's level that contains the center of the element's current
+     * bounding box, and redistribute the DOFs of all FE systems accordingly.
+     *
+     * Elements that are not located within any patch keep their current
+     * owners.  Aligning the mesh partitioning with the patch decomposition
+     * reduces the number of ghost DOFs that need to be communicated during
+     * spreading and interpolation.
+     *
+     * \note This method requires a serial (replicated) mesh.  It should be
+     * followed by a call to reinitElementMappings().
+     */
+    void repartitionMesh();
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -311,10 +349,43 @@ public:
     /*!
      * \return A pointer to the ghosted solution vector associated with the
      * specified system.
+     *
+     * \note If localize_data is true, the ghosted vector is updated only if
+     * the solution vector (or the ghosted vector) has been modified since the
+     * data were last localized.
      */
     libMesh::NumericVector<double>* buildGhostedSolutionVector(const std::string& system_name,
                                                                bool localize_data = true);
 
+    /*!
+     * \brief Build the ghosted solution vectors associated with the specified
+     * systems.
+     *
+     * \note If localize_data is true, data for all of the systems are
+     * localized using a single round of communication.
+     */
+    void buildGhostedSolutionVectors(std::vector<libMesh::NumericVector<double>*>& ghost_vecs,
+                                     const std::vector<std::string>& system_names,
+                                     bool localize_data = true);
+
+    /*!
+     * \brief Copy the values of each of the specified vectors into the
+     * corresponding ghosted vector, including ghost values.
+     *
+     * A ghosted vector is updated only if it was not last localized from the
+     * same vector, or if either vector has been modified since then.  Ghost
+     * values of all of the vectors that require updating are communicated in a
+     * single round of communication.
+     *
+     * \note Modifications are detected locally on each MPI process, and so the
+     * vectors must only be modified by operations that are performed by all
+     * MPI processes.
+     *
+     * \note All vectors must be libMesh::PetscVector objects.
+     */
+    void localizeGhostedVectors(const std::vector<libMesh::NumericVector<double>*>& vecs,
+                                const std::vector<libMesh::NumericVector<double>*>& ghost_vecs);
+
     /*!
      * \return A pointer to the unghosted coordinates (nodal position) vector.
      */
@@ -452,10 +523,80 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \brief Set each U[k] to be the L2 projection of the corresponding F[k].
+     *
+     * All of the right-hand sides are solved using the same (cached) mass
+     * matrix and preconditioner, so that the preconditioner is set up at most
+     * once for the entire batch.
+     *
+     * \return true if all of the projections converged.
+     */
+    bool computeL2Projection(const std::vector<libMesh::NumericVector<double>*>& U,
+                             const std::vector<libMesh::NumericVector<double>*>& F,
+                             const std::string& system_name,
+                             bool consistent_mass_matrix = true,
+                             libMesh::QuadratureType quad_type = libMesh::QGAUSS,
+                             libMesh::Order quad_order = libMesh::FIFTH,
+                             double tol = 1.0e-6,
+                             unsigned int max_its = 100);
+
+    /*!
+     * \brief Print the number of L2 projection solves, the total number of
+     * Krylov iterations, and the total solve time for each system since the
+     * statistics were last reset.
+     */
+    void printL2ProjectionStatistics(std::ostream& os) const;
+
+    /*!
+     * \brief Reset the L2 projection solver statistics.
+     */
+    void resetL2ProjectionStatistics();
+
+    /*!
+     * \brief Print the total number of quadrature points used for force
+     * spreading and velocity interpolation since the statistics were last
+     * reset, summed over all processes.
+     *
+     * \note This is a collective operation.
+     */
+    void printQuadratureStatistics(std::ostream& os) const;
+
+    /*!
+     * \brief Reset the quadrature point statistics.
+     */
+    void resetQuadratureStatistics();
+
+    /*!
+     * \brief Print the number of ghosted vectors that were localized and the
+     * number of localizations that were skipped because the ghosted vectors
+     * were already current since the statistics were last reset.
+     */
+    void printLocalizationStatistics(std::ostream& os) const;
+
+    /*!
+     * \brief Reset the ghosted vector localization statistics.
+     */
+    void resetLocalizationStatistics();
+
     /*!
      * Update the quarature rule for the current element.  If the provided
      * qrule is already configured appropriately, it is not modified.
      *
+     * When adaptive quadrature is used, the number of points along each
+     * direction is chosen so that there are at least point_density points per
+     * Cartesian grid cell along the longest edge of the element in its current
+     * configuration.  If use_strain_indicator is true, the density is instead
+     * interpolated between min_point_density and point_density according to
+     * the largest edge strain of the element, so that fewer points are used
+     * for elements that are nearly undeformed, and point_density is used once
+     * the largest edge strain reaches strain_threshold.  min_point_density is
+     * expected not to exceed point_density.
+     *
+     * \note The strain indicator only measures changes in edge lengths, and so
+     * it does not detect deformations that preserve them (e.g., pure shear of
+     * a quadrilateral or hexahedral element).
+     *
      * \return true if the quadrature rule is updated or otherwise requires
      * reinitialization (e.g. because the element type or p_level changed);
      * false otherwise.
@@ -467,7 +608,10 @@ public:
                                      double point_density,
                                      libMesh::Elem* elem,
                                      const boost::multi_array<double, 2>& X_node,
-                                     double dx_min);
+                                     double dx_min,
+                                     bool use_strain_indicator = false,
+                                     double min_point_density = 1.0,
+                                     double strain_threshold = 0.1);
 
     /*!
      * Update the quadrature rule for the current element used by the
@@ -640,19 +784,45 @@ private:
     void updateQuadPointCountData(int coarsest_ln, int finest_ln);
 
     /*!
-     * Compute the bounding boxes of all active elements.
+     * Compute the bounding boxes of the active elements that are owned by this
+     * MPI process.  The elements and their bounding boxes are stored in
+     * d_active_local_elems and d_active_local_elem_bboxes.
      *
-     * \note For inactive elements, the lower and upper bound values will be
-     * identically zero.
+     * \note This method does not perform any global communication beyond that
+     * required to update the ghosted coordinate vector.
      */
-    std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes();
+    void computeActiveLocalElementBoundingBoxes();
+
+    /*!
+     * Return the cached shape function values of the specified FE object for
+     * the given quadrature rule on elements of the same type as the given
+     * element, computing them if necessary.
+     */
+    const std::vector<std::vector<double> >&
+    getCachedPhi(libMesh::FEBase* fe, libMesh::QBase* qrule, const libMesh::Elem* elem);
+
+    /*!
+     * Return the cached quadrature weights (i.e., JxW values) for the given
+     * element and quadrature rule, computing them if necessary.
+     */
+    const std::vector<double>& getCachedJxW(libMesh::FEBase* fe, libMesh::QBase* qrule, const libMesh::Elem* elem);
+
+    /*!
+     * Close the specified vector unless it has not been modified since it was
+     * last localized.
+     */
+    void closeGhostedVector(libMesh::NumericVector<double>& ghost_vec);
 
     /*!
      * Collect all of the active elements which are located within a local
      * Cartesian grid patch grown by the specified ghost cell width.
      *
      * In this method, the determination as to whether an element is local or
-     * not is based on the position of the bounding box of the element.
+     * not is based on the position of the bounding box of the element.  Each
+     * MPI process computes the bounding boxes of its own elements, and sends
+     * each element only to those processes that own a patch that intersects
+     * the element's bounding box.  Candidate patches are located using a
+     * coarse binning of the index space of the level.
      */
     void collectActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
                                     int level_number,
@@ -752,22 +922,83 @@ private:
      */
     std::vector<std::vector<libMesh::Elem*> > d_active_patch_elem_map;
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
-    std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
+    std::vector<libMesh::Elem*> d_active_local_elems;
+    std::vector<std::pair<Point, Point> > d_active_local_elem_bboxes;
+
+    /*
+     * Cached quadrature data used when spreading and interpolating.
+     *
+     * Shape function values depend only on the FE type, the element type, and
+     * the quadrature rule, and so they are shared by all elements that use the
+     * same rule.  Quadrature weights are computed with respect to the
+     * reference configuration of the mesh, and so they are cached for each
+     * element and are reused for as long as the quadrature rule chosen for that
+     * element does not change.
+     */
+    struct QuadratureCacheKey
+    {
+        libMesh::ElemType elem_type;
+        unsigned int p_level;
+        libMesh::QuadratureType quad_type;
+        libMesh::Order quad_order;
+
+        bool operator<(const QuadratureCacheKey& that) const
+        {
+            if (elem_type != that.elem_type) return elem_type < that.elem_type;
+            if (p_level != that.p_level) return p_level < that.p_level;
+            if (quad_type != that.quad_type) return quad_type < that.quad_type;
+            return quad_order < that.quad_order;
+        }
+    };
+    std::map<std::pair<libMesh::FEType, QuadratureCacheKey>, std::vector<std::vector<double> > > d_phi_cache;
+    std::map<unsigned int, std::pair<QuadratureCacheKey, std::vector<double> > > d_JxW_cache;
 
     /*
      * Ghost vectors for the various equation systems.
      */
     std::map<std::string, libMesh::NumericVector<double>*> d_system_ghost_vec;
 
+    /*
+     * The source vector and the states of the source and ghosted vectors at
+     * the time that each ghosted vector was last localized, indexed by the
+     * PETSc object ID of the ghosted vector.
+     */
+    struct GhostVecLocalizationRecord
+    {
+        PetscObjectId vec_id;
+        PetscObjectState vec_state, ghost_vec_state;
+    };
+    std::map<PetscObjectId, GhostVecLocalizationRecord> d_ghost_vec_localization_records;
+    unsigned int d_num_ghost_vec_localizations, d_num_skipped_ghost_vec_localizations;
+
     /*
      * Linear solvers and related data for performing interpolation in the IB-FE
      * framework.
      */
-    std::map<std::string, libMesh::LinearSolver<double>*> d_L2_proj_solver;
-    std::map<std::string, libMesh::SparseMatrix<double>*> d_L2_proj_matrix;
+    typedef std::pair<std::string, std::pair<libMesh::QuadratureType, libMesh::Order> > L2ProjectionSolverKey;
+    std::map<L2ProjectionSolverKey, libMesh::LinearSolver<double>*> d_L2_proj_solver;
+    std::map<L2ProjectionSolverKey, libMesh::SparseMatrix<double>*> d_L2_proj_matrix;
     std::map<std::string, libMesh::NumericVector<double>*> d_L2_proj_matrix_diag;
-    std::map<std::string, libMesh::QuadratureType> d_L2_proj_quad_type;
-    std::map<std::string, libMesh::Order> d_L2_proj_quad_order;
+
+    /*
+     * Statistics for the L2 projection solves performed for each system.
+     */
+    struct L2ProjectionStatistics
+    {
+        L2ProjectionStatistics() : num_solves(0), num_iterations(0), solve_time(0.0)
+        {
+        }
+
+        unsigned int num_solves, num_iterations;
+        double solve_time;
+    };
+    std::map<std::string, L2ProjectionStatistics> d_L2_proj_stats;
+
+    /*
+     * The number of quadrature points used for spreading and interpolation
+     * since the statistics were last reset.
+     */
+    unsigned long d_num_spread_qps, d_num_interp_qps;
 };
 } // namespace IBTK
 
@@ -496,6 +496,20 @@ public:
              int dst_depth = 0,
              int src2_depth = 0);
 
+    /*!
+     * \brief Synchronize the coarse values of a side-centered normal vector
+     * field on each coarse-fine interface.
+     *
+     * Coarse values on each coarse-fine interface are replaced by the averages
+     * of the overlying fine values.  This is the same synchronization that is
+     * performed by div() when src1_cf_bdry_synch is true.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void synchCoarseFineBoundary(int dst_idx,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_var);
+
     /*!
      * \brief Compute the gradient of a scalar quantity using centered
      * differences.
@@ -277,21 +277,73 @@ public:
      * \brief Restore any arrays extracted via calls to getArray(),
      * getLocalFormArray(), and getGhostedLocalFormArray().
      *
+     * \param data_modified Indicates whether the data may have been modified
+     * via the extracted arrays.  Callers that only \em read the array data
+     * should pass \p false so that the ghost values are not needlessly marked
+     * as being out of date.
+     *
      * \note Any outstanding references to the underlying array data are
      * invalidated by restoreArrays().
      */
-    void restoreArrays();
+    void restoreArrays(bool data_modified = true);
 
     /*!
      * \brief Begin updating ghost values.
+     *
+     * \note The ghost update is skipped on all processes if the ghost values
+     * are already current on all processes.  This decision requires a global
+     * reduction, so this method must be called by all processes.
+     *
+     * \note An update that has been started but not ended is completed
+     * automatically the next time that the data are accessed, so that
+     * communication may be overlapped with other work.
+     *
+     * \see isGhostDataCurrent()
      */
     void beginGhostUpdate();
 
     /*!
      * \brief End updating ghost values.
+     *
+     * \note This is a no-op if no ghost update is in progress.
      */
     void endGhostUpdate();
 
+    /*!
+     * \brief Returns true if the data stored on this process have not been
+     * modified since the ghost values were last updated.
+     *
+     * \note The ghost values are consistent with the values stored on the
+     * processes that own the corresponding nodes only if this is true on all
+     * processes.
+     *
+     * \note Modifications to the data are detected via the state of the
+     * underlying PETSc Vec object and via calls to restoreArrays().
+     */
+    bool isGhostDataCurrent();
+
+    /*!
+     * \brief Returns a counter that is incremented whenever the data stored on
+     * this process are modified.
+     *
+     * \note Modifications are detected via the state of the underlying PETSc
+     * Vec object and via calls to restoreArrays().  The data version is not
+     * changed by ghost updates.
+     */
+    unsigned int getDataVersion();
+
+    /*!
+     * \brief Get the number of ghost updates that were performed and that
+     * were skipped (because the ghost values were already current) since the
+     * last call to resetGhostUpdateCounts().
+     */
+    static void getGhostUpdateCounts(unsigned int& num_performed, unsigned int& num_skipped);
+
+    /*!
+     * \brief Reset the ghost update counters.
+     */
+    static void resetGhostUpdateCounts();
+
     /*!
      * \brief Write out object state to the given database.
      */
@@ -320,6 +372,12 @@ private:
     void getArrayCommon();
     void getGhostedLocalFormArrayCommon();
 
+    /*
+     * Check whether the data have been modified via PETSc since the data
+     * version was last updated.
+     */
+    void updateDataVersion();
+
     /*
      * The name of the LData object.
      */
@@ -369,6 +427,20 @@ private:
     double* d_ghosted_local_array;
     boost::multi_array_ref<double, 1>* d_boost_ghosted_local_array;
     boost::multi_array_ref<double, 2>* d_boost_vec_ghosted_local_array;
+
+    /*
+     * Data used to keep track of modifications to the data and of whether the
+     * ghost values are consistent with the local values, so that redundant
+     * ghost updates can be skipped.
+     */
+    PetscObjectState d_data_state;
+    unsigned int d_data_version, d_ghost_data_version;
+    bool d_ghost_update_in_progress;
+
+    /*
+     * The number of ghost updates that have been performed or skipped.
+     */
+    static unsigned int s_num_ghost_updates_performed, s_num_ghost_updates_skipped;
 };
 } // namespace IBTK
 
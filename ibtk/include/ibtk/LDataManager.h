@@ -659,6 +659,36 @@ public:
      */
     std::pair<Point, Point> computeLagrangianStructureBoundingBox(int structure_id, int level_number);
 
+    /*!
+     * \brief Get the bounding boxes of all of the Lagrangian structures on the
+     * specified level of the patch hierarchy, indexed by structure ID.
+     *
+     * \note The bounding boxes and centers of mass of all structures on the
+     * level are cached, and they are recomputed only when the positions of the
+     * nodes on the level have been modified.  Modifications are detected
+     * locally on each MPI process, and so the position data must only be
+     * modified by operations that are performed by all MPI processes (e.g.,
+     * PETSc Vec operations or calls to LData::getArray() and
+     * LData::restoreArrays()).
+     *
+     * \note This method is collective (i.e., must be called by all MPI
+     * processes).
+     */
+    const std::map<int, std::pair<Point, Point> >& getLagrangianStructureBoundingBoxes(int level_number);
+
+    /*!
+     * \brief Recompute the bounding boxes and centers of mass of all of the
+     * Lagrangian structures on the specified level of the patch hierarchy.
+     *
+     * The data for all structures are computed in a single pass over the local
+     * nodes, and are combined across MPI processes using one batched reduction
+     * for the bounding boxes and one for the centers of mass.
+     *
+     * \note This method is collective (i.e., must be called by all MPI
+     * processes).
+     */
+    void updateLagrangianStructureBoundingBoxes(int level_number);
+
     /*!
      * \brief Reset the positions of the nodes of the Lagrangian structure with
      * the specified ID to be equal to the initial positions but shifted so that
@@ -709,6 +739,12 @@ public:
     /*!
      * \brief Set the components of the supplied LData object to zero
      * for those entries that correspond to inactivated structures.
+     *
+     * \note Nodes of inactivated structures are excluded from the cached
+     * patch indexing data, so that spreading and interpolation never visit
+     * them, and spread() and interp() zero the inactivated components of the
+     * Lagrangian force data.  It is therefore not necessary to call this
+     * method before spreading or after interpolation.
      */
     void zeroInactivatedComponents(SAMRAI::tbox::Pointer<LData> lag_data, int level_number) const;
 
@@ -787,6 +823,28 @@ public:
      */
     void endDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Begin the process of refilling nonlocal Lagrangian quantities over
+     * the specified range of levels in the patch hierarchy.
+     *
+     * The operation is essentially equivalent to refilling ghost cells for
+     * structured (SAMRAI native) data.
+     *
+     * \note The fill is completed by endNonlocalDataFill(), or automatically
+     * when the data are next accessed.  Work that does not require nonlocal
+     * Lagrangian data can be performed in between to overlap the communication.
+     */
+    void beginNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
+
+    /*!
+     * \brief End the process of refilling nonlocal Lagrangian quantities over
+     * the specified range of levels in the patch hierarchy.
+     *
+     * The operation is essentially equivalent to refilling ghost cells for
+     * structured (SAMRAI native) data.
+     */
+    void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
+
     /*!
      * \brief Update the workload and count of nodes per cell.
      *
@@ -947,24 +1005,6 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
-    /*!
-     * \brief Begin the process of refilling nonlocal Lagrangian quantities over
-     * the specified range of levels in the patch hierarchy.
-     *
-     * The operation is essentially equivalent to refilling ghost cells for
-     * structured (SAMRAI native) data.
-     */
-    void beginNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
-
-    /*!
-     * \brief End the process of refilling nonlocal Lagrangian quantities over
-     * the specified range of levels in the patch hierarchy.
-     *
-     * The operation is essentially equivalent to refilling ghost cells for
-     * structured (SAMRAI native) data.
-     */
-    void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
-
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -1002,6 +1042,35 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Determine whether the cached bounding boxes and centers of mass of the
+     * Lagrangian structures on the specified level are current.
+     *
+     * \note The cache is invalidated by events that are seen by all MPI
+     * processes (regridding, level initialization, and modifications to the
+     * position data), so this check does not require any communication.
+     */
+    bool lagrangianStructureBoundingBoxesAreCurrent(int level_number);
+
+    /*!
+     * Rebuild the sorted ranges of Lagrangian indices and the local PETSc
+     * indices that correspond to inactivated structures on the specified
+     * level.  If cache_patch_indices is true, the cached indexing data on each
+     * patch of the level is also rebuilt so that inactive nodes are excluded.
+     */
+    void updateInactiveLagrangianIndexData(int level_number, bool cache_patch_indices);
+
+    /*!
+     * Set the local and ghost components of the supplied LData object that
+     * correspond to inactivated structures to zero using the cached local
+     * PETSc indices.  Unlike zeroInactivatedComponents(), this does not
+     * require any communication.
+     *
+     * \note Any ghost update of the LData object must be completed before this
+     * method is called.
+     */
+    void zeroInactivatedLocalComponents(SAMRAI::tbox::Pointer<LData> lag_data, int level_number) const;
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1138,11 +1207,29 @@ private:
     std::vector<std::map<int, std::pair<int, int> > > d_strct_id_to_lag_idx_range_map;
     std::vector<std::map<int, int> > d_last_lag_idx_to_strct_id_map;
     std::vector<ParallelSet> d_inactive_strcts;
+
+    /*!
+     * Sorted, non-overlapping ranges of Lagrangian indices corresponding to
+     * inactivated structures, and the local (ghosted) PETSc indices of the
+     * inactive nodes that are local to or ghosted on this MPI process.
+     */
+    std::vector<std::vector<std::pair<int, int> > > d_inactive_lag_idx_ranges;
+    std::vector<std::vector<int> > d_inactive_local_petsc_idxs;
+
     std::vector<std::vector<int> > d_displaced_strct_ids;
     std::vector<std::vector<std::pair<Point, Point> > > d_displaced_strct_bounding_boxes;
     std::vector<std::vector<LNodeSet::value_type> > d_displaced_strct_lnode_idxs;
     std::vector<std::vector<Point> > d_displaced_strct_lnode_posns;
 
+    /*!
+     * Cached bounding boxes and centers of mass of the Lagrangian structures,
+     * along with the version of the position data used to compute them.
+     */
+    std::vector<std::map<int, std::pair<Point, Point> > > d_strct_bounding_boxes;
+    std::vector<std::map<int, Point> > d_strct_centers_of_mass;
+    std::vector<bool> d_strct_bounding_boxes_valid;
+    std::vector<unsigned int> d_strct_bounding_boxes_posn_version;
+
     /*!
      * Lagrangian mesh data.
      */
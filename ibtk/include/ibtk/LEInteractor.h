@@ -58,6 +58,11 @@ class LIndexSetData;
 } // namespace IBTK
 namespace SAMRAI
 {
+namespace geom
+{
+template <int DIM>
+class CartesianPatchGeometry;
+} // namespace geom
 namespace hier
 {
 template <int DIM>
@@ -849,6 +854,52 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
+     * positions of the nodes of the Lagrangian mesh are specified by X_data.
+     *
+     * This version takes raw pointers to the patch data and patch geometry,
+     * and does not copy or create any SAMRAI::tbox::Pointer objects.  It may
+     * therefore be called concurrently for distinct patches, provided that the
+     * patch data and patch geometry objects are kept alive by the caller.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::pdat::CellData<NDIM, double>* q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       const SAMRAI::geom::CartesianPatchGeometry<NDIM>* patch_geom,
+                       const SAMRAI::hier::Box<NDIM>& patch_box,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const std::string& spread_fcn = "IB_4");
+
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
+     * positions of the nodes of the Lagrangian mesh are specified by X_data.
+     *
+     * This version takes raw pointers to the patch data and patch geometry,
+     * and does not copy or create any SAMRAI::tbox::Pointer objects.  It may
+     * therefore be called concurrently for distinct patches, provided that the
+     * patch data and patch geometry objects are kept alive by the caller.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::pdat::SideData<NDIM, double>* q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       const SAMRAI::geom::CartesianPatchGeometry<NDIM>* patch_geom,
+                       const SAMRAI::hier::Box<NDIM>& patch_box,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1090,6 +1141,19 @@ private:
                                   int X_size,
                                   int X_depth);
 
+    /*!
+     * \brief Compute the local PETSc indices located within the provided box
+     * based on the positions of the Lagrangian mesh nodes, without copying any
+     * SAMRAI::tbox::Pointer objects.
+     */
+    static void buildLocalIndices(std::vector<int>& local_indices,
+                                  const SAMRAI::hier::Box<NDIM>& box,
+                                  const SAMRAI::geom::CartesianPatchGeometry<NDIM>* patch_geom,
+                                  const SAMRAI::hier::Box<NDIM>& patch_box,
+                                  const double* X_data,
+                                  int X_size,
+                                  int X_depth);
+
     /*!
      * Implementation of the IB interpolation operation for a user-defined
      * kernel.
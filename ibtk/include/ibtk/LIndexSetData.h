@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <utility>
 #include <vector>
 
 #include "Box.h"
@@ -85,6 +86,26 @@ public:
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
 
+    /*!
+     * \brief Update the cached indexing data, excluding all indices whose
+     * Lagrangian index lies in one of the specified half-open ranges.
+     *
+     * \note The ranges must be sorted and non-overlapping.  Excluded indices
+     * are omitted from all of the cached index lists, so that operations
+     * driven by these lists (e.g., spreading and interpolation) never visit
+     * them.
+     */
+    void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges);
+
+    /*!
+     * \return Whether the specified Lagrangian index was included in the
+     * cached indexing data, i.e., whether it does not lie in one of the
+     * inactive ranges provided to cacheLocalIndices().
+     */
+    bool isActiveLagrangianIndex(int lag_idx) const;
+
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
      * lie in the patch (including the ghost cell region).
@@ -189,6 +210,7 @@ private:
     std::vector<int> d_global_petsc_indices, d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
     std::vector<int> d_local_petsc_indices, d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
     std::vector<double> d_periodic_shifts, d_interior_periodic_shifts, d_ghost_periodic_shifts;
+    std::vector<std::pair<int, int> > d_inactive_lag_idx_ranges;
 };
 } // namespace IBTK
 
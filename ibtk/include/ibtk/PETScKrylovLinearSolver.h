@@ -45,6 +45,7 @@
 #include "SAMRAIVectorReal.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PETScKrylovRecycleSpace.h"
 #include "mpi.h"
 #include "petscksp.h"
 #include "petscmat.h"
@@ -110,6 +111,7 @@ namespace IBTK
  rel_residual_tol = 1.0e-5     // see setRelativeTolerance()
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
+ recycle_space_size = 0        // see setRecycleSpaceSize()
  enable_logging = FALSE        // see setLoggingEnabled()
  \endverbatim
  *
@@ -170,6 +172,20 @@ public:
      */
     void setOptionsPrefix(const std::string& options_prefix);
 
+    /*!
+     * \brief Set the maximum number of previous solution corrections that are
+     * retained and used to form the initial guess for subsequent solves.
+     *
+     * When the size is nonzero, the initial guess supplied to the KSP object
+     * minimizes the residual over the span of the retained corrections; see
+     * class PETScKrylovRecycleSpace.  This is effective when a sequence of
+     * systems with the same or a slowly varying operator is solved, e.g., once
+     * per time step.  The retained vectors are discarded whenever the solver
+     * state is deallocated, so the solver should be initialized prior to
+     * calling solveSystem() for recycling to have any effect.
+     */
+    void setRecycleSpaceSize(int recycle_space_size);
+
     /*!
      * \name Functions to access the underlying PETSc objects.
      */
@@ -419,6 +435,8 @@ private:
     Vec d_petsc_nullspace_constant_vec;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace;
+
+    PETScKrylovRecycleSpace d_recycle_space;
 };
 } // namespace IBTK
 
@@ -0,0 +1,190 @@
+// Filename: PETScKrylovRecycleSpace.h
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PETScKrylovRecycleSpace
+#define included_IBTK_PETScKrylovRecycleSpace
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <deque>
+
+#include "petscmat.h"
+#include "petscvec.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PETScKrylovRecycleSpace retains a small subspace of previously
+ * computed solutions of a linear system \f$Ax=b\f$ and uses it to form initial
+ * guesses for subsequent solves with the same or a slowly varying operator.
+ *
+ * The space stores pairs \f$(v_k, q_k)\f$ with \f$q_k = A v_k\f$, where the
+ * vectors \f$q_k\f$ are orthonormal.  Given an initial guess \f$x_0\f$,
+ * formInitialGuess() replaces it by the vector
+ * \f$x_0 + \sum_k (q_k, b - A x_0) v_k\f$, which minimizes the residual norm
+ * over the affine space \f$x_0 + \mbox{span}\{v_k\}\f$.  After each solve,
+ * update() adds the correction computed by the Krylov method to the space.
+ * When the space is full, the oldest pair is discarded.
+ *
+ * Because the operator may change between solves (e.g., when the time step
+ * size changes), formInitialGuess() recomputes the images \f$q_k = A v_k\f$
+ * with the current operator and orthonormalizes them again before projecting,
+ * so that the projected residual is the true residual of the new initial
+ * guess.  Each call to formInitialGuess() therefore requires getSize() + 1
+ * applications of the operator, and each call to update() requires one.
+ * Because the initial guess is optimal over all of the retained corrections,
+ * this subsumes polynomial extrapolation of the solution from previous time
+ * steps.
+ *
+ * \note All stored vectors are created by VecDuplicate() and must be released
+ * via reset() before the vectors used to create them are invalidated, e.g.,
+ * when the patch hierarchy is regridded.
+ */
+class PETScKrylovRecycleSpace
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    PETScKrylovRecycleSpace();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PETScKrylovRecycleSpace();
+
+    /*!
+     * \brief Set the maximum number of retained vectors.  A value of zero
+     * disables recycling.
+     */
+    void setMaxSize(int max_size);
+
+    /*!
+     * \brief Get the maximum number of retained vectors.
+     */
+    int getMaxSize() const;
+
+    /*!
+     * \brief Get the number of currently retained vectors.
+     */
+    int getSize() const;
+
+    /*!
+     * \brief Replace \a x by the residual-minimizing initial guess for the
+     * system \f$Ax=b\f$.
+     *
+     * If \a initial_guess_nonzero is \p false, the contents of \a x are
+     * ignored and the projection is computed relative to \f$x_0=0\f$.
+     */
+    void formInitialGuess(Mat A, Vec x, Vec b, bool initial_guess_nonzero);
+
+    /*!
+     * \brief Add the difference between the solution \a x and the most recent
+     * initial guess to the space.
+     *
+     * \note This method must be preceded by a call to formInitialGuess().
+     */
+    void update(Mat A, Vec x);
+
+    /*!
+     * \brief Destroy all retained vectors.
+     */
+    void reset();
+
+    /*!
+     * \brief Get the norm of \f$b - A x_0\f$ before the projection computed by
+     * the most recent call to formInitialGuess().
+     */
+    double getInitialResidualNorm() const;
+
+    /*!
+     * \brief Get the norm of \f$b - A x_0\f$ after the projection computed by
+     * the most recent call to formInitialGuess().
+     */
+    double getProjectedResidualNorm() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PETScKrylovRecycleSpace(const PETScKrylovRecycleSpace& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PETScKrylovRecycleSpace& operator=(const PETScKrylovRecycleSpace& that);
+
+    /*!
+     * \brief Orthonormalize the image \a q against the retained images, apply
+     * the same transformation to the correction \a v, and add the pair to the
+     * space.  The pair is destroyed instead if \a q is (nearly) contained in
+     * the span of the retained images.
+     */
+    void appendOrthonormalized(Vec v, Vec q);
+
+    /*!
+     * \brief Remove the oldest vectors until at most \a size vectors remain.
+     */
+    void truncate(int size);
+
+    int d_max_size;
+
+    /*!
+     * \brief The retained corrections and their (orthonormal) images under the
+     * operator.
+     */
+    std::deque<Vec> d_sol_vecs, d_img_vecs;
+
+    /*!
+     * \brief The most recent initial guess and a work vector.
+     */
+    Vec d_x0, d_r;
+
+    double d_initial_residual_norm, d_projected_residual_norm;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PETScKrylovRecycleSpace
@@ -38,6 +38,9 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxList.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
 #include "IntVector.h"
@@ -98,6 +101,25 @@ namespace IBTK
  * FACPreconditionerStrategy implementing many of the operations required by
  * smoothers for the Poisson equation and related problems.
  *
+ * When smoother_ghost_cell_width is larger than one, red-black Gauss-Seidel
+ * smoothers may use communication-avoiding smoothing on levels that do not
+ * have a coarse-fine interface: the error and residual are copied into scratch
+ * data with the specified ghost cell width, and up to that many red or black
+ * relaxation passes are performed per ghost cell exchange by redundantly
+ * updating the ghost cells that lie on neighboring patches.  Near non-periodic
+ * physical boundaries, such redundantly updated values may differ slightly
+ * from those computed by the owning patch, so the smoother is not identical
+ * to the corresponding number of standard sweeps there.
+ *
+ * Smoothers that support the "CHEBYSHEV" smoother type apply a Chebyshev
+ * polynomial in the Jacobi-preconditioned operator.  The polynomial targets
+ * the interval [chebyshev_lower_eig_fraction*lambda,
+ * chebyshev_upper_eig_factor*lambda], in which lambda is an estimate of the
+ * largest eigenvalue of the Jacobi-preconditioned operator on each level that
+ * is obtained by chebyshev_eig_estimate_iterations power iterations the first
+ * time that the level is smoothed.  When chebyshev_eig_estimate_iterations is
+ * zero, the Gershgorin bound lambda = 2 is used instead.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
@@ -108,6 +130,10 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ smoother_ghost_cell_width = 1                // see above
+ chebyshev_eig_estimate_iterations = 10       // see above
+ chebyshev_lower_eig_fraction = 0.3           // see above
+ chebyshev_upper_eig_factor = 1.1             // see above
  \endverbatim
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
@@ -353,6 +379,94 @@ protected:
      */
     void xeqScheduleDataSynch(int dst_idx, int dst_ln);
 
+    /*!
+     * \brief Execute schedule for filling the ghost cells of the
+     * communication-avoiding smoother scratch data on the specified level.
+     *
+     * The right-hand-side scratch data are filled only when fill_rhs is true.
+     */
+    void xeqScheduleDeepHaloFill(int dst_ln, bool fill_rhs);
+
+    //\}
+
+    /*!
+     * \name Methods for communication-avoiding smoothing.
+     */
+    //\{
+
+    /*!
+     * \brief Indicate whether communication-avoiding smoothing may be used on
+     * the specified level.
+     */
+    bool useDeepHaloSmoothing(int ln) const;
+
+    /*!
+     * \brief Reset the physical boundary ghost cell values of the
+     * communication-avoiding smoother solution scratch data on the specified
+     * level.  No communication is performed.
+     */
+    void setDeepHaloPhysicalBoundaryConditions(int ln);
+
+    /*!
+     * \brief Perform a single "red" or "black" Gauss-Seidel pass for F = alpha
+     * div grad U + beta U over the indices in the specified box.
+     *
+     * Indices at which the (optional) mask is nonzero are left unmodified.
+     */
+    void redBlackSmoothBox(SAMRAI::pdat::ArrayData<NDIM, double>& U_data,
+                           const SAMRAI::pdat::ArrayData<NDIM, double>& F_data,
+                           const SAMRAI::pdat::ArrayData<NDIM, int>* mask_data,
+                           const SAMRAI::hier::Box<NDIM>& box,
+                           int depth,
+                           const double* dx,
+                           int red_or_black) const;
+
+    //\}
+
+    /*!
+     * \name Methods for Chebyshev smoothing.
+     */
+    //\{
+
+    /*!
+     * \brief Compute the Jacobi correction Z = D^{-1} (F - A U) for A = alpha
+     * div grad + beta and D = diag(A) over the indices in the specified box.
+     *
+     * When F_data is NULL, F is taken to be zero.  The correction is set to
+     * zero at indices at which the (optional) mask is nonzero.
+     */
+    void computeJacobiCorrectionBox(SAMRAI::pdat::ArrayData<NDIM, double>& Z_data,
+                                    const SAMRAI::pdat::ArrayData<NDIM, double>& U_data,
+                                    const SAMRAI::pdat::ArrayData<NDIM, double>* F_data,
+                                    const SAMRAI::pdat::ArrayData<NDIM, int>* mask_data,
+                                    const SAMRAI::hier::Box<NDIM>& box,
+                                    int depth,
+                                    const double* dx) const;
+
+    /*!
+     * \brief Perform a single Chebyshev update over the indices in the
+     * specified box, setting D := d_coef D + z_coef D^{-1} (F - A U) and then
+     * U := U + D.
+     *
+     * The direction D is not read when d_coef is zero.
+     */
+    void chebyshevUpdateBox(SAMRAI::pdat::ArrayData<NDIM, double>& U_data,
+                            SAMRAI::pdat::ArrayData<NDIM, double>& D_data,
+                            const SAMRAI::pdat::ArrayData<NDIM, double>& F_data,
+                            const SAMRAI::pdat::ArrayData<NDIM, int>* mask_data,
+                            const SAMRAI::hier::Box<NDIM>& box,
+                            int depth,
+                            const double* dx,
+                            double d_coef,
+                            double z_coef) const;
+
+    /*!
+     * \brief Compute the coefficients of the specified Chebyshev iteration for
+     * the given estimate of the largest eigenvalue of the Jacobi-preconditioned
+     * operator.
+     */
+    void getChebyshevCoefficients(int iteration, double eig_max, double& d_coef, double& z_coef) const;
+
     //\}
 
     /*
@@ -455,6 +569,30 @@ protected:
      */
     int d_scratch_idx;
 
+    /*
+     * Ghost cell width and patch descriptor indices for the scratch data used
+     * by communication-avoiding smoothers.
+     */
+    int d_smoother_gcw;
+    int d_halo_sol_idx, d_halo_rhs_idx;
+
+    /*
+     * Levels on which communication-avoiding smoothing may be used, and, for
+     * each local patch on those levels, the cells outside the patch box that
+     * are redundantly updated by the smoother.
+     */
+    std::vector<bool> d_deep_halo_level;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_halo_boxes;
+
+    /*
+     * Chebyshev smoother parameters and the per-level estimates of the largest
+     * eigenvalue of the Jacobi-preconditioned operator (negative values
+     * indicate that no estimate has been computed).
+     */
+    int d_chebyshev_eig_estimate_iterations;
+    double d_chebyshev_lower_eig_fraction, d_chebyshev_upper_eig_factor;
+    std::vector<double> d_chebyshev_eig_max;
+
     //\}
 
     /*!
@@ -539,6 +677,15 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_synch_refine_algorithm;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_synch_refine_schedules;
 
+    /*
+     * Operators for filling the ghost cells of the communication-avoiding
+     * smoother scratch data.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_halo_fill_refine_algorithm,
+        d_halo_sol_fill_refine_algorithm;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_halo_fill_refine_schedules,
+        d_halo_sol_fill_refine_schedules;
+
     //\}
 };
 } // namespace IBTK
@@ -0,0 +1,343 @@
+// Filename: PoissonFFTLevelSolver.h
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PoissonFFTLevelSolver
+#define included_IBTK_PoissonFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <complex>
+#include <vector>
+
+#include "Box.h"
+#include "PatchHierarchy.h"
+#include "SAMRAIVectorReal.h"
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class PatchLevel;
+} // namespace hier
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PoissonFFTLevelSolver is an abstract LinearSolver for solving
+ * elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + D \nabla^2)
+ * u$} = f \f$ with scalar \f$C\f$ and \f$D\f$ on a \em single
+ * SAMRAI::hier::PatchLevel that covers a triply periodic (doubly periodic in
+ * 2D) computational domain.
+ *
+ * The standard second-order finite difference Laplacian is diagonalized by the
+ * discrete Fourier transform on periodic domains, so that the system is solved
+ * directly in \f$O(N \log N)\f$ operations.  When \f$C = 0\f$, the zero mode
+ * of the solution is set to zero, i.e., the mean of the solution is removed.
+ *
+ * The transform is distributed with a slab decomposition.  Each MPI process
+ * owns a contiguous range of grid planes normal to the last coordinate
+ * direction, in which it performs the transforms along the remaining
+ * directions, and a contiguous range of grid lines along the first coordinate
+ * direction, in which it performs the transforms along the last direction.
+ * Each solve moves the data between these layouts with all-to-all exchanges,
+ * so that the memory and work per process scale as \f$O(N/P)\f$.  Because the
+ * slabs are not subdivided further, at most as many processes as there are
+ * grid planes in the last coordinate direction take part in the transform.
+ *
+ * \note Only fully periodic, single-box computational domains are supported.
+ * Physical boundaries would require sine or cosine transforms instead.  The
+ * patch level must also cover the entire domain, so that these solvers are
+ * suitable for uniform grids, or as coarse-grid solvers, but not as AMR level
+ * solvers.
+ *
+ * The values of \f$C\f$ and \f$D\f$ are read each time that solveSystem() is
+ * called, so that changes to the problem coefficients (e.g., due to changes in
+ * the time step size) do not require the solver state to be reinitialized.
+ *
+ * Subclasses provide the mapping between patch data of a particular centering
+ * and the unified periodic grid data.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE  // see setLoggingEnabled()
+ \endverbatim
+ */
+class PoissonFFTLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    PoissonFFTLevelSolver();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PoissonFFTLevelSolver();
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * \note The solver need not be initialized prior to calling solveSystem();
+     * however, see initializeSolverState() and deallocateSolverState() for
+     * opportunities to save overhead when performing multiple consecutive
+     * solves.
+     *
+     * \return \p true, since the system is solved directly
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * An unrecoverable error occurs if the vectors are not defined on a single
+     * patch level that covers a periodic, single-box computational domain.
+     *
+     * \note It is safe to call initializeSolverState() when the state is
+     * already initialized.  In this case, the solver state is first deallocated
+     * and then reinitialized.
+     *
+     * \note Subclasses of class PoissonFFTLevelSolver should \em not override
+     * this method.  Instead, they should override the protected method
+     * initializeSolverStateSpecialized().
+     *
+     * \see deallocateSolverState
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \note It is safe to call deallocateSolverState() when the solver state is
+     * already deallocated.
+     *
+     * \see initializeSolverState
+     */
+    void deallocateSolverState();
+
+    //\}
+
+protected:
+    /*!
+     * \brief Basic initialization.
+     */
+    void init(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$
+     * and return the number of scalar data components that are solved
+     * independently.
+     */
+    virtual int initializeSolverStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) = 0;
+
+    /*!
+     * \brief Set the offsets in the unified periodic grid data (see
+     * getFFTDataOffset()) of the local values of the specified data component.
+     *
+     * When \a owned_only is \p true, only the locally owned values are listed,
+     * and each degree of freedom must be owned by exactly one patch.
+     * Otherwise, all local values that are set by copyFromFFTData() are listed.
+     */
+    virtual void getFFTDataOffsets(std::vector<int>& fft_offsets, int fft_comp, bool owned_only) = 0;
+
+    /*!
+     * \brief Append the locally owned values of the specified data component to
+     * \a fft_values, in the order given by getFFTDataOffsets() with \a
+     * owned_only set to \p true.
+     */
+    virtual void copyToFFTData(std::vector<double>& fft_values,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b,
+                               int fft_comp) = 0;
+
+    /*!
+     * \brief Copy \a fft_values to the local values of the specified data
+     * component, in the order given by getFFTDataOffsets() with \a owned_only
+     * set to \p false.
+     */
+    virtual void copyFromFFTData(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                 const std::vector<double>& fft_values,
+                                 int fft_comp) = 0;
+
+    /*!
+     * \brief Return the offset of the specified cell index in the unified
+     * periodic grid data, wrapping indices that lie outside of d_domain_box.
+     */
+    int getFFTDataOffset(const SAMRAI::hier::Index<NDIM>& i) const;
+
+    /*!
+     * \brief Associated hierarchy.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*!
+     * \brief Associated patch level.
+     */
+    int d_level_num;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+
+    /*!
+     * \brief Index space of the computational domain on the associated patch
+     * level.
+     */
+    SAMRAI::hier::Box<NDIM> d_domain_box;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PoissonFFTLevelSolver(const PoissonFFTLevelSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PoissonFFTLevelSolver& operator=(const PoissonFFTLevelSolver& that);
+
+    /*!
+     * \brief Communication pattern between a list of local values and the
+     * slabs that own them.
+     *
+     * Entry k of the local list is stored at position local_perm[k] of a
+     * buffer that is ordered by owning process.  The owning process stores
+     * the values that it receives at the slab offsets slab_offsets.
+     */
+    struct FFTDataMap
+    {
+        std::vector<int> local_perm, local_counts, local_displs;
+        std::vector<int> slab_offsets, slab_counts, slab_displs;
+    };
+
+    /*!
+     * \brief Setup the communication pattern for the specified unified
+     * periodic grid data offsets.
+     */
+    void initializeFFTDataMap(FFTDataMap& map, const std::vector<int>& fft_offsets);
+
+    /*!
+     * \brief Send local values to the slabs that own them.
+     */
+    void scatterToSlabs(const FFTDataMap& map, const std::vector<double>& fft_values);
+
+    /*!
+     * \brief Retrieve local values from the slabs that own them.
+     */
+    void gatherFromSlabs(const FFTDataMap& map, std::vector<double>& fft_values);
+
+    /*!
+     * \brief Redistribute the transform data between the slab and column
+     * layouts.
+     */
+    void transposeSlabsToColumns();
+    void transposeColumnsToSlabs();
+
+    /*!
+     * \brief Transform all lines of the specified data along direction \a axis.
+     */
+    void transformLines(std::vector<std::complex<double> >& data,
+                        const int (&extents)[NDIM],
+                        unsigned int axis,
+                        bool forward);
+
+    /*!
+     * \brief Solve the periodic system for the slab data in place.
+     */
+    void solvePeriodicSystem(double C, double D);
+
+    /*!
+     * \brief Number of independently solved data components.
+     */
+    int d_num_fft_comps;
+
+    /*!
+     * \brief Symbol of the discrete Laplacian along each coordinate direction.
+     */
+    std::vector<double> d_laplace_symbol[NDIM];
+
+    /*!
+     * \brief Parallel decomposition of the transform data.  Process r owns the
+     * planes with last-direction indices in [d_slab_lower[r],
+     * d_slab_lower[r+1]) and the lines with first-direction indices in
+     * [d_column_lower[r], d_column_lower[r+1]).
+     */
+    std::vector<int> d_slab_lower, d_column_lower;
+    std::vector<int> d_slab_transpose_counts, d_slab_transpose_displs;
+    std::vector<int> d_column_transpose_counts, d_column_transpose_displs;
+
+    /*!
+     * \brief Communication patterns used to copy the right-hand side to the
+     * slabs and the solution from the slabs, for each data component.
+     */
+    std::vector<FFTDataMap> d_to_fft_maps, d_from_fft_maps;
+
+    /*!
+     * \brief Work arrays.
+     */
+    std::vector<double> d_fft_values, d_value_send_buf, d_value_recv_buf;
+    std::vector<std::complex<double> > d_slab_data, d_column_data, d_transpose_buf, d_line_in, d_line_out;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PoissonFFTLevelSolver
@@ -0,0 +1,158 @@
+// Filename: SCPoissonFFTLevelSolver.h
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_SCPoissonFFTLevelSolver
+#define included_IBTK_SCPoissonFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "SAMRAIVectorReal.h"
+#include "ibtk/PoissonFFTLevelSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SCPoissonFFTLevelSolver is a concrete PoissonFFTLevelSolver for
+ * solving elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + D
+ * \nabla^2) u$} = f \f$ on a \em single SAMRAI::hier::PatchLevel that covers a
+ * periodic computational domain, where \f$C\f$ and \f$D\f$ are scalars, and
+ * \f$u\f$ and \f$f\f$ are side-centered arrays.
+ *
+ * A separate periodic system is solved for each data depth and each component
+ * of the side-centered data.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE  // see setLoggingEnabled()
+ \endverbatim
+ */
+class SCPoissonFFTLevelSolver : public PoissonFFTLevelSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SCPoissonFFTLevelSolver(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Static function to construct a SCPoissonFFTLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new SCPoissonFFTLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+protected:
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     */
+    int initializeSolverStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                         const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Set the offsets in the unified periodic grid data of the local
+     * values of the specified data component.
+     */
+    void getFFTDataOffsets(std::vector<int>& fft_offsets, int fft_comp, bool owned_only);
+
+    /*!
+     * \brief Append the locally owned values of the specified data component to
+     * \a fft_values.
+     */
+    void copyToFFTData(std::vector<double>& fft_values,
+                       const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b,
+                       int fft_comp);
+
+    /*!
+     * \brief Copy \a fft_values to all local values of the specified data
+     * component.
+     */
+    void copyFromFFTData(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                         const std::vector<double>& fft_values,
+                         int fft_comp);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SCPoissonFFTLevelSolver(const SCPoissonFFTLevelSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SCPoissonFFTLevelSolver& operator=(const SCPoissonFFTLevelSolver& that);
+
+    /*!
+     * \brief Data depth.
+     */
+    int d_depth;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SCPoissonFFTLevelSolver
@@ -106,6 +106,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ smoother_ghost_cell_width = 1                // see PoissonFACPreconditionerStrategy
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
@@ -150,6 +151,7 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -257,6 +259,22 @@ private:
      */
     SCPoissonPointRelaxationFACOperator& operator=(const SCPoissonPointRelaxationFACOperator& that);
 
+    /*!
+     * \brief Perform the specified number of red or black relaxation passes
+     * using the communication-avoiding scratch data, exchanging ghost cell
+     * values only once every smoother_ghost_cell_width passes.
+     */
+    void smoothErrorDeepHalo(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                             const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                             int level_num,
+                             int num_passes);
+
+    /*!
+     * \brief Estimate the largest eigenvalue of the Jacobi-preconditioned
+     * level operator by power iteration.
+     */
+    double estimateChebyshevEigenvalue(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error, int level_num);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -49,6 +49,14 @@ namespace IBTK
 /*!
  * \brief Class SCPoissonSolverManager is a singleton manager class to provide
  * access to generic side-centered PoissonSolver implementations.
+ *
+ * \note Unlike CCPoissonSolverManager, this class does not provide a
+ * composite-grid hypre solver type.  HYPRE_LEVEL_SOLVER solves single-level
+ * problems only, and locally refined side-centered problems are solved with
+ * FAC preconditioners.  Assembling the side-centered composite-grid operator
+ * in a hypre SStruct matrix (cf. CCPoissonHypreCompositeSolver) requires
+ * eliminating the coarse-fine ghost values of both the normal and the
+ * tangential velocity components and is not implemented.
  */
 class SCPoissonSolverManager
 {
@@ -77,6 +85,7 @@ public:
     static const std::string DEFAULT_LEVEL_SOLVER;
     static const std::string HYPRE_LEVEL_SOLVER;
     static const std::string PETSC_LEVEL_SOLVER;
+    static const std::string FFT_LEVEL_SOLVER;
 
     /*!
      * Return a pointer to the instance of the solver manager.  Access to
@@ -71,6 +71,7 @@ enum MGCycleType
 {
     F_CYCLE,
     FMG_CYCLE,
+    K_CYCLE,
     V_CYCLE,
     W_CYCLE,
     UNKNOWN_MG_CYCLE_TYPE = -1
@@ -86,6 +87,9 @@ string_to_enum<MGCycleType>(const std::string& val)
     if (strcasecmp(val.c_str(), "FMG") == 0) return FMG_CYCLE;
     if (strcasecmp(val.c_str(), "FMG_CYCLE") == 0) return FMG_CYCLE;
     if (strcasecmp(val.c_str(), "FMG-CYCLE") == 0) return FMG_CYCLE;
+    if (strcasecmp(val.c_str(), "K") == 0) return K_CYCLE;
+    if (strcasecmp(val.c_str(), "K_CYCLE") == 0) return K_CYCLE;
+    if (strcasecmp(val.c_str(), "K-CYCLE") == 0) return K_CYCLE;
     if (strcasecmp(val.c_str(), "V") == 0) return V_CYCLE;
     if (strcasecmp(val.c_str(), "V_CYCLE") == 0) return V_CYCLE;
     if (strcasecmp(val.c_str(), "V-CYCLE") == 0) return V_CYCLE;
@@ -101,6 +105,7 @@ enum_to_string<MGCycleType>(MGCycleType val)
 {
     if (val == F_CYCLE) return "F_CYCLE";
     if (val == FMG_CYCLE) return "FMG_CYCLE";
+    if (val == K_CYCLE) return "K_CYCLE";
     if (val == V_CYCLE) return "V_CYCLE";
     if (val == W_CYCLE) return "W_CYCLE";
     return "UNKNOWN_MG_CYCLE_TYPE";
@@ -78,6 +78,7 @@ LData::getDepth() const
 inline Vec
 LData::getVec()
 {
+    if (d_ghost_update_in_progress) endGhostUpdate();
     restoreArrays();
     return d_global_vec;
 } // getVec
@@ -134,8 +135,9 @@ LData::getGhostedLocalFormVecArray()
 } // getGhostedLocalFormVecArray
 
 inline void
-LData::restoreArrays()
+LData::restoreArrays(const bool data_modified)
 {
+    const bool arrays_outstanding = d_array || d_ghosted_local_vec;
     int ierr;
     if (d_ghosted_local_array)
     {
@@ -167,32 +169,42 @@ LData::restoreArrays()
         d_boost_vec_array = NULL;
         d_boost_local_vec_array = NULL;
     }
+    if (arrays_outstanding)
+    {
+        // NOTE: Restoring the arrays always increments the state of the PETSc
+        // Vec.  If the data were only read, we record the new state without
+        // changing the data version.
+        if (data_modified) ++d_data_version;
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(d_global_vec), &d_data_state);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // restoreArray
 
-inline void
-LData::beginGhostUpdate()
+inline bool
+LData::isGhostDataCurrent()
 {
-    const int ierr = VecGhostUpdateBegin(getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // beginGhostUpdate
+    if (d_array || d_ghosted_local_vec) return false;
+    updateDataVersion();
+    return d_ghost_data_version == d_data_version;
+} // isGhostDataCurrent
 
-inline void
-LData::endGhostUpdate()
+inline unsigned int
+LData::getDataVersion()
 {
-    const int ierr = VecGhostUpdateEnd(getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // endGhostUpdate
+    if (!d_array && !d_ghosted_local_vec) updateDataVersion();
+    return d_data_version;
+} // getDataVersion
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 inline void
 LData::getArrayCommon()
 {
+    if (d_ghost_update_in_progress) endGhostUpdate();
     if (!d_array)
     {
+        if (!d_ghosted_local_vec) updateDataVersion();
         int ierr = VecGetArray(d_global_vec, &d_array);
         IBTK_CHKERRQ(ierr);
         int ilower, iupper;
@@ -219,8 +231,10 @@ LData::getArrayCommon()
 inline void
 LData::getGhostedLocalFormArrayCommon()
 {
+    if (d_ghost_update_in_progress) endGhostUpdate();
     if (!d_ghosted_local_vec)
     {
+        if (!d_array) updateDataVersion();
         int ierr = VecGhostGetLocalForm(d_global_vec, &d_ghosted_local_vec);
         IBTK_CHKERRQ(ierr);
     }
@@ -242,6 +256,20 @@ LData::getGhostedLocalFormArrayCommon()
     return;
 } // getGhostedLocalFormArrayCommon
 
+inline void
+LData::updateDataVersion()
+{
+    PetscObjectState state;
+    const int ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(d_global_vec), &state);
+    IBTK_CHKERRQ(ierr);
+    if (state != d_data_state)
+    {
+        d_data_state = state;
+        ++d_data_version;
+    }
+    return;
+} // updateDataVersion
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -35,7 +35,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include "ibtk/LIndexSetData.h"
+#include "ibtk/compiler_hints.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -43,6 +49,20 @@ namespace IBTK
 {
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+template <class T>
+inline bool
+LIndexSetData<T>::isActiveLagrangianIndex(const int lag_idx) const
+{
+    if (LIKELY(d_inactive_lag_idx_ranges.empty())) return true;
+    std::vector<std::pair<int, int> >::const_iterator it =
+        std::upper_bound(d_inactive_lag_idx_ranges.begin(),
+                         d_inactive_lag_idx_ranges.end(),
+                         std::make_pair(lag_idx, std::numeric_limits<int>::max()));
+    if (it == d_inactive_lag_idx_ranges.begin()) return true;
+    --it;
+    return !(it->first <= lag_idx && lag_idx < it->second);
+} // isActiveLagrangianIndex
+
 template <class T>
 inline const std::vector<int>&
 LIndexSetData<T>::getLagrangianIndices() const
@@ -48,6 +48,7 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianCellDoubleWeightedAverage.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -96,7 +97,9 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_parallel_type.h"
+#include "libmesh/enum_preconditioner_type.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/enum_solver_type.h"
 #include "libmesh/equation_systems.h"
 #include "libmesh/fe_interface.h"
 #include "libmesh/fe_type.h"
@@ -105,6 +108,7 @@
 #include "libmesh/mesh_base.h"
 #include "libmesh/node.h"
 #include "libmesh/numeric_vector.h"
+#include "libmesh/partitioner.h"
 #include "libmesh/petsc_linear_solver.h"
 #include "libmesh/petsc_matrix.h"
 #include "libmesh/petsc_vector.h"
@@ -115,6 +119,7 @@
 #include "libmesh/string_to_enum.h"
 #include "libmesh/system.h"
 #include "libmesh/tensor_value.h"
+#include "libmesh/threads.h"
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "petscksp.h"
@@ -155,7 +160,9 @@ namespace
 {
 // Timers.
 static Timer* t_reinit_element_mappings;
+static Timer* t_repartition_mesh;
 static Timer* t_build_ghosted_solution_vector;
+static Timer* t_localize_ghosted_vectors;
 static Timer* t_spread;
 static Timer* t_prolong_data;
 static Timer* t_interp;
@@ -195,6 +202,36 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     return;
 } // collect_unique_elems
 
+// Bin the specified boxes on a coarse index space whose bins are as large as
+// the largest box, so that the boxes that may intersect a given region can be
+// located without searching all of the boxes.
+void
+bin_boxes(std::vector<std::vector<int> >& bin_box_idxs,
+          Box<NDIM>& bin_domain,
+          IntVector<NDIM>& bin_size,
+          const std::vector<Box<NDIM> >& boxes)
+{
+    bin_size = IntVector<NDIM>(1);
+    bin_domain = Box<NDIM>();
+    for (unsigned int k = 0; k < boxes.size(); ++k)
+    {
+        bin_size.max(boxes[k].numberCells());
+        bin_domain += boxes[k];
+    }
+    bin_domain.coarsen(bin_size);
+    bin_box_idxs.clear();
+    bin_box_idxs.resize(bin_domain.size());
+    for (unsigned int k = 0; k < boxes.size(); ++k)
+    {
+        const Box<NDIM> bin_box = Box<NDIM>::coarsen(boxes[k], bin_size);
+        for (Box<NDIM>::Iterator b(bin_box); b; b++)
+        {
+            bin_box_idxs[bin_domain.offset(b())].push_back(k);
+        }
+    }
+    return;
+} // bin_boxes
+
 inline short int
 get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
 {
@@ -217,8 +254,23 @@ get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
 } // get_dirichlet_bdry_ids
 
 inline double
-get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
+get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node, double* const max_edge_strain = NULL)
 {
+    // When requested, also compute the largest relative change in the length
+    // of an element edge between the reference and current configurations.
+    static const unsigned int max_edges = 12;
+    double h_ref[max_edges];
+    const bool is_edge_elem = elem->type() == EDGE2 || elem->type() == EDGE3 || elem->type() == EDGE4;
+    const unsigned int n_edges = is_edge_elem ? 1 : elem->n_edges();
+    TBOX_ASSERT(n_edges <= max_edges);
+    if (max_edge_strain)
+    {
+        for (unsigned int e = 0; e < n_edges; ++e)
+        {
+            h_ref[e] = is_edge_elem ? elem->hmax() : elem->build_edge(e)->hmax();
+        }
+    }
+
     const unsigned int max_nodes = (elem->dim() == 3 ? 27 : 9);
     std::vector<libMesh::Point> s_node_cache(max_nodes);
     const unsigned int n_node = elem->n_nodes();
@@ -233,19 +285,15 @@ get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
         }
     }
     double hmax = 0.0;
-    switch (elem->type())
-    {
-    case EDGE2:
-    case EDGE3:
-    case EDGE4:
-        hmax = elem->hmax();
-        break;
-    default:
-        for (unsigned int e = 0; e < elem->n_edges(); ++e)
+    if (max_edge_strain) *max_edge_strain = 0.0;
+    for (unsigned int e = 0; e < n_edges; ++e)
+    {
+        const double h = is_edge_elem ? elem->hmax() : elem->build_edge(e)->hmax();
+        hmax = std::max(hmax, h);
+        if (max_edge_strain && h_ref[e] > 0.0)
         {
-            hmax = std::max(hmax, elem->build_edge(e)->hmax());
+            *max_edge_strain = std::max(*max_edge_strain, std::abs(h / h_ref[e] - 1.0));
         }
-        break;
     }
     for (unsigned int k = 0; k < n_node; ++k)
     {
@@ -253,6 +301,298 @@ get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
     }
     return hmax;
 } // get_elem_hmax
+
+// Thread body that computes the physical positions of the quadrature points of
+// a range of elements and, when F data are provided, the values of F*JxW at
+// those points.  Each element writes to a disjoint range of the output arrays,
+// and all scratch data are private to each invocation of the body.
+class ComputeQuadraturePointValues
+{
+public:
+    ComputeQuadraturePointValues(double* const F_JxW_qp,
+                                 double* const X_qp,
+                                 const std::vector<Elem*>& elems,
+                                 const std::vector<unsigned int>& elem_qp_offset,
+                                 const std::vector<const std::vector<std::vector<double> >*>& elem_phi_F,
+                                 const std::vector<const std::vector<std::vector<double> >*>& elem_phi_X,
+                                 const std::vector<const std::vector<double>*>& elem_JxW_F,
+                                 const unsigned int n_vars,
+                                 const DofMap* const F_dof_map,
+                                 const PetscVector<double>* const F_petsc_vec,
+                                 const double* const F_local_soln,
+                                 const DofMap& X_dof_map,
+                                 const PetscVector<double>& X_petsc_vec,
+                                 const double* const X_local_soln)
+        : d_F_JxW_qp(F_JxW_qp),
+          d_X_qp(X_qp),
+          d_elems(elems),
+          d_elem_qp_offset(elem_qp_offset),
+          d_elem_phi_F(elem_phi_F),
+          d_elem_phi_X(elem_phi_X),
+          d_elem_JxW_F(elem_JxW_F),
+          d_n_vars(n_vars),
+          d_F_dof_map(F_dof_map),
+          d_F_petsc_vec(F_petsc_vec),
+          d_F_local_soln(F_local_soln),
+          d_X_dof_map(X_dof_map),
+          d_X_petsc_vec(X_petsc_vec),
+          d_X_local_soln(X_local_soln)
+    {
+        // intentionally blank
+        return;
+    } // ComputeQuadraturePointValues
+
+    void operator()(const libMesh::Threads::BlockedRange<int>& range) const
+    {
+        const bool compute_F = d_F_JxW_qp != NULL;
+        boost::multi_array<double, 2> F_node, X_node;
+        std::vector<std::vector<unsigned int> > F_dof_indices(d_n_vars), X_dof_indices(NDIM);
+        for (int e_idx = range.begin(); e_idx < range.end(); ++e_idx)
+        {
+            const Elem* const elem = d_elems[e_idx];
+            if (compute_F)
+            {
+                for (unsigned int i = 0; i < d_n_vars; ++i)
+                {
+                    d_F_dof_map->dof_indices(elem, F_dof_indices[i], i);
+                }
+                get_values_for_interpolation(F_node, *d_F_petsc_vec, d_F_local_soln, F_dof_indices);
+            }
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_X_dof_map.dof_indices(elem, X_dof_indices[d], d);
+            }
+            get_values_for_interpolation(X_node, d_X_petsc_vec, d_X_local_soln, X_dof_indices);
+            const std::vector<std::vector<double> >& phi_X = *d_elem_phi_X[e_idx];
+            const unsigned int n_node = elem->n_nodes();
+            const unsigned int qp_offset = d_elem_qp_offset[e_idx];
+            const unsigned int n_qp = d_elem_qp_offset[e_idx + 1] - qp_offset;
+            double* const X_begin = d_X_qp + NDIM * qp_offset;
+            std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+            for (unsigned int k = 0; k < n_node; ++k)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const double& p_X = phi_X[k][qp];
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        X_begin[NDIM * qp + i] += X_node[k][i] * p_X;
+                    }
+                }
+            }
+            if (!compute_F) continue;
+            const std::vector<std::vector<double> >& phi_F = *d_elem_phi_F[e_idx];
+            const std::vector<double>& JxW_F = *d_elem_JxW_F[e_idx];
+            double* const F_begin = d_F_JxW_qp + d_n_vars * qp_offset;
+            std::fill(F_begin, F_begin + d_n_vars * n_qp, 0.0);
+            for (unsigned int k = 0; k < n_node; ++k)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const double p_JxW_F = phi_F[k][qp] * JxW_F[qp];
+                    for (unsigned int i = 0; i < d_n_vars; ++i)
+                    {
+                        F_begin[d_n_vars * qp + i] += F_node[k][i] * p_JxW_F;
+                    }
+                }
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    double* const d_F_JxW_qp;
+    double* const d_X_qp;
+    const std::vector<Elem*>& d_elems;
+    const std::vector<unsigned int>& d_elem_qp_offset;
+    const std::vector<const std::vector<std::vector<double> >*>& d_elem_phi_F;
+    const std::vector<const std::vector<std::vector<double> >*>& d_elem_phi_X;
+    const std::vector<const std::vector<double>*>& d_elem_JxW_F;
+    const unsigned int d_n_vars;
+    const DofMap* const d_F_dof_map;
+    const PetscVector<double>* const d_F_petsc_vec;
+    const double* const d_F_local_soln;
+    const DofMap& d_X_dof_map;
+    const PetscVector<double>& d_X_petsc_vec;
+    const double* const d_X_local_soln;
+};
+
+// Thread body that computes the element right-hand-side vectors of the L2
+// projection of the values at the quadrature points of a range of elements.
+// The element vectors are computed with private scratch data, but only one
+// thread at a time may add its values to the global vector.
+class AccumulateElementRHS
+{
+public:
+    AccumulateElementRHS(NumericVector<double>& F_vec,
+                         libMesh::Threads::spin_mutex& F_vec_mutex,
+                         const double* const F_qp,
+                         const std::vector<Elem*>& elems,
+                         const std::vector<unsigned int>& elem_qp_offset,
+                         const std::vector<const std::vector<std::vector<double> >*>& elem_phi_F,
+                         const std::vector<const std::vector<double>*>& elem_JxW_F,
+                         const unsigned int n_vars,
+                         const DofMap& F_dof_map)
+        : d_F_vec(F_vec),
+          d_F_vec_mutex(F_vec_mutex),
+          d_F_qp(F_qp),
+          d_elems(elems),
+          d_elem_qp_offset(elem_qp_offset),
+          d_elem_phi_F(elem_phi_F),
+          d_elem_JxW_F(elem_JxW_F),
+          d_n_vars(n_vars),
+          d_F_dof_map(F_dof_map)
+    {
+        // intentionally blank
+        return;
+    } // AccumulateElementRHS
+
+    void operator()(const libMesh::Threads::BlockedRange<int>& range) const
+    {
+        std::vector<DenseVector<double> > F_rhs_e(d_n_vars);
+        std::vector<std::vector<unsigned int> > F_dof_indices(d_n_vars);
+        for (int e_idx = range.begin(); e_idx < range.end(); ++e_idx)
+        {
+            const Elem* const elem = d_elems[e_idx];
+            for (unsigned int i = 0; i < d_n_vars; ++i)
+            {
+                d_F_dof_map.dof_indices(elem, F_dof_indices[i], i);
+                F_rhs_e[i].resize(static_cast<int>(F_dof_indices[i].size()));
+            }
+            const std::vector<std::vector<double> >& phi_F = *d_elem_phi_F[e_idx];
+            const std::vector<double>& JxW_F = *d_elem_JxW_F[e_idx];
+            const unsigned int qp_offset = d_elem_qp_offset[e_idx];
+            const unsigned int n_qp = d_elem_qp_offset[e_idx + 1] - qp_offset;
+            const size_t n_basis = F_dof_indices[0].size();
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                const int idx = d_n_vars * (qp_offset + qp);
+                for (unsigned int k = 0; k < n_basis; ++k)
+                {
+                    const double p_JxW_F = phi_F[k][qp] * JxW_F[qp];
+                    for (unsigned int i = 0; i < d_n_vars; ++i)
+                    {
+                        F_rhs_e[i](k) += d_F_qp[idx + i] * p_JxW_F;
+                    }
+                }
+            }
+            for (unsigned int i = 0; i < d_n_vars; ++i)
+            {
+                d_F_dof_map.constrain_element_vector(F_rhs_e[i], F_dof_indices[i]);
+            }
+            libMesh::Threads::spin_mutex::scoped_lock lock(d_F_vec_mutex);
+            for (unsigned int i = 0; i < d_n_vars; ++i)
+            {
+                d_F_vec.add_vector(F_rhs_e[i], F_dof_indices[i]);
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    NumericVector<double>& d_F_vec;
+    libMesh::Threads::spin_mutex& d_F_vec_mutex;
+    const double* const d_F_qp;
+    const std::vector<Elem*>& d_elems;
+    const std::vector<unsigned int>& d_elem_qp_offset;
+    const std::vector<const std::vector<std::vector<double> >*>& d_elem_phi_F;
+    const std::vector<const std::vector<double>*>& d_elem_JxW_F;
+    const unsigned int d_n_vars;
+    const DofMap& d_F_dof_map;
+};
+
+// Thread body that spreads the values at the quadrature points of a range of
+// local patches onto the Cartesian grid.  Each patch is processed by exactly
+// one thread, and so the (non-atomic) reference counts of the patch objects are
+// modified by at most one thread at a time.
+class SpreadPatchValues
+{
+public:
+    SpreadPatchValues(const std::vector<const CartesianPatchGeometry<NDIM>*>& patch_geoms,
+                      const std::vector<const Box<NDIM>*>& patch_boxes,
+                      const std::vector<CellData<NDIM, double>*>& f_cc_patch_data,
+                      const std::vector<SideData<NDIM, double>*>& f_sc_patch_data,
+                      const std::vector<std::vector<double> >& F_JxW_qp,
+                      const std::vector<std::vector<double> >& X_qp,
+                      const unsigned int n_vars,
+                      const IntVector<NDIM>& ghost_width,
+                      const std::string& kernel_fcn)
+        : d_patch_geoms(patch_geoms),
+          d_patch_boxes(patch_boxes),
+          d_f_cc_patch_data(f_cc_patch_data),
+          d_f_sc_patch_data(f_sc_patch_data),
+          d_F_JxW_qp(F_JxW_qp),
+          d_X_qp(X_qp),
+          d_n_vars(n_vars),
+          d_ghost_width(ghost_width),
+          d_kernel_fcn(kernel_fcn)
+    {
+        // intentionally blank
+        return;
+    } // SpreadPatchValues
+
+    void operator()(const libMesh::Threads::BlockedRange<int>& range) const
+    {
+        // NOTE: SAMRAI reference counting is not thread safe, so only raw
+        // pointers to the patch objects are used here.  The corresponding
+        // tbox::Pointer objects are held by the caller.
+        for (int k = range.begin(); k < range.end(); ++k)
+        {
+            if (d_X_qp[k].empty()) continue;
+
+            // NOTE: Values are spread only from those quadrature points that
+            // are within the ghost cell width of the patch interior.
+            const Box<NDIM>& patch_box = *d_patch_boxes[k];
+            const Box<NDIM> spread_box = Box<NDIM>::grow(patch_box, d_ghost_width);
+            const int Q_size = static_cast<int>(d_F_JxW_qp[k].size());
+            const int X_size = static_cast<int>(d_X_qp[k].size());
+            if (d_f_cc_patch_data[k])
+            {
+                LEInteractor::spread(d_f_cc_patch_data[k],
+                                     &d_F_JxW_qp[k][0],
+                                     Q_size,
+                                     d_n_vars,
+                                     &d_X_qp[k][0],
+                                     X_size,
+                                     NDIM,
+                                     d_patch_geoms[k],
+                                     patch_box,
+                                     spread_box,
+                                     d_kernel_fcn);
+            }
+            else
+            {
+                LEInteractor::spread(d_f_sc_patch_data[k],
+                                     &d_F_JxW_qp[k][0],
+                                     Q_size,
+                                     d_n_vars,
+                                     &d_X_qp[k][0],
+                                     X_size,
+                                     NDIM,
+                                     d_patch_geoms[k],
+                                     patch_box,
+                                     spread_box,
+                                     d_kernel_fcn);
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    const std::vector<const CartesianPatchGeometry<NDIM>*>& d_patch_geoms;
+    const std::vector<const Box<NDIM>*>& d_patch_boxes;
+    const std::vector<CellData<NDIM, double>*>& d_f_cc_patch_data;
+    const std::vector<SideData<NDIM, double>*>& d_f_sc_patch_data;
+    const std::vector<std::vector<double> >& d_F_JxW_qp;
+    const std::vector<std::vector<double> >& d_X_qp;
+    const unsigned int d_n_vars;
+    const IntVector<NDIM>& d_ghost_width;
+    const std::string& d_kernel_fcn;
+};
+
+// Grain sizes used when threading loops over elements and patches.
+static const unsigned int ELEM_GRAIN_SIZE = 16;
+static const unsigned int PATCH_GRAIN_SIZE = 1;
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -401,6 +741,7 @@ FEDataManager::reinitElementMappings()
     // Delete cached hierarchy-dependent data.
     d_active_patch_elem_map.clear();
     d_active_patch_ghost_dofs.clear();
+    d_JxW_cache.clear();
     for (std::map<std::string, NumericVector<double>*>::iterator it = d_system_ghost_vec.begin();
          it != d_system_ghost_vec.end();
          ++it)
@@ -408,6 +749,7 @@ FEDataManager::reinitElementMappings()
         delete it->second;
     }
     d_system_ghost_vec.clear();
+    d_ghost_vec_localization_records.clear();
 
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
@@ -416,6 +758,123 @@ FEDataManager::reinitElementMappings()
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::repartitionMesh()
+{
+    IBTK_TIMER_START(t_repartition_mesh);
+
+    MeshBase& mesh = d_es->get_mesh();
+    if (!mesh.is_serial())
+    {
+        TBOX_WARNING(d_object_name << "::repartitionMesh():\n"
+                                   << "  repartitioning is supported only for serial meshes; skipping.\n");
+        IBTK_TIMER_STOP(t_repartition_mesh);
+        return;
+    }
+
+    // Locate the patches on the level.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const ProcessorMapping& level_mapping = level->getProcessorMapping();
+    const int num_patches = level->getNumberOfPatches();
+    std::vector<Box<NDIM> > patch_boxes(num_patches);
+    for (int k = 0; k < num_patches; ++k)
+    {
+        patch_boxes[k] = level_boxes[k];
+    }
+    IntVector<NDIM> bin_size;
+    Box<NDIM> bin_domain;
+    std::vector<std::vector<int> > bin_patches;
+    bin_boxes(bin_patches, bin_domain, bin_size, patch_boxes);
+
+    // Determine the new owner of each local element whose bounding box center
+    // lies within a patch.
+    computeActiveLocalElementBoundingBoxes();
+    std::vector<int> send_buf;
+    send_buf.reserve(2 * d_active_local_elems.size());
+    for (unsigned int e = 0; e < d_active_local_elems.size(); ++e)
+    {
+        const Elem* const elem = d_active_local_elems[e];
+        const std::pair<Point, Point>& elem_bbox = d_active_local_elem_bboxes[e];
+        const Point elem_center = 0.5 * (elem_bbox.first + elem_bbox.second);
+        const CellIndex<NDIM> i = IndexUtilities::getCellIndex(elem_center, grid_geom, ratio);
+        const Index<NDIM> bin_idx = Index<NDIM>::coarsen(i, bin_size);
+        if (!bin_domain.contains(bin_idx)) continue;
+        const std::vector<int>& patches = bin_patches[bin_domain.offset(bin_idx)];
+        for (std::vector<int>::const_iterator cit = patches.begin(); cit != patches.end(); ++cit)
+        {
+            if (!patch_boxes[*cit].contains(i)) continue;
+            const int new_owner = level_mapping.getProcessorAssignment(*cit);
+            if (new_owner != static_cast<int>(elem->processor_id()))
+            {
+                send_buf.push_back(static_cast<int>(elem->id()));
+                send_buf.push_back(new_owner);
+            }
+            break;
+        }
+    }
+
+    // Exchange the (element id, new owner) pairs for the elements that change
+    // owners, so that every process has a consistent view of the partitioning.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int send_count = static_cast<int>(send_buf.size());
+    std::vector<int> recv_counts(mpi_size), recv_displs(mpi_size, 0);
+    MPI_Allgather(&send_count, 1, MPI_INT, &recv_counts[0], 1, MPI_INT, communicator);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    }
+    const int recv_size = recv_displs[mpi_size - 1] + recv_counts[mpi_size - 1];
+    if (recv_size == 0)
+    {
+        IBTK_TIMER_STOP(t_repartition_mesh);
+        return;
+    }
+    send_buf.resize(std::max(send_count, 1));
+    std::vector<int> recv_buf(recv_size);
+    MPI_Allgatherv(
+        &send_buf[0], send_count, MPI_INT, &recv_buf[0], &recv_counts[0], &recv_displs[0], MPI_INT, communicator);
+    plog << d_object_name << "::repartitionMesh(): reassigning " << recv_size / 2 << " elements\n";
+
+    // Reassign the elements and nodes and redistribute the DOFs.
+    for (int k = 0; k < recv_size; k += 2)
+    {
+        mesh.elem(recv_buf[k])->processor_id() = recv_buf[k + 1];
+    }
+    Partitioner::set_parent_processor_ids(mesh);
+    Partitioner::set_node_processor_ids(mesh);
+    d_es->reinit();
+
+    // Delete cached data that depend on the DOF distribution.
+    for (std::map<L2ProjectionSolverKey, LinearSolver<double>*>::iterator it = d_L2_proj_solver.begin();
+         it != d_L2_proj_solver.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_solver.clear();
+    for (std::map<L2ProjectionSolverKey, SparseMatrix<double>*>::iterator it = d_L2_proj_matrix.begin();
+         it != d_L2_proj_matrix.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_matrix.clear();
+    for (std::map<std::string, NumericVector<double>*>::iterator it = d_L2_proj_matrix_diag.begin();
+         it != d_L2_proj_matrix_diag.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_matrix_diag.clear();
+
+    IBTK_TIMER_STOP(t_repartition_mesh);
+    return;
+} // repartitionMesh
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -449,12 +908,141 @@ FEDataManager::buildGhostedSolutionVector(const std::string& system_name, const
         d_system_ghost_vec[system_name] = sol_ghost_vec.release();
     }
     NumericVector<double>* sol_ghost_vec = d_system_ghost_vec[system_name];
-    if (localize_data) sol_vec->localize(*sol_ghost_vec);
+    if (localize_data)
+    {
+        localizeGhostedVectors(std::vector<NumericVector<double>*>(1, sol_vec),
+                               std::vector<NumericVector<double>*>(1, sol_ghost_vec));
+    }
 
     IBTK_TIMER_STOP(t_build_ghosted_solution_vector);
     return sol_ghost_vec;
 } // buildGhostedSolutionVector
 
+void
+FEDataManager::buildGhostedSolutionVectors(std::vector<NumericVector<double>*>& ghost_vecs,
+                                           const std::vector<std::string>& system_names,
+                                           const bool localize_data)
+{
+    std::vector<NumericVector<double>*> sol_vecs(system_names.size());
+    ghost_vecs.resize(system_names.size());
+    for (unsigned int k = 0; k < system_names.size(); ++k)
+    {
+        sol_vecs[k] = getSolutionVector(system_names[k]);
+        ghost_vecs[k] = buildGhostedSolutionVector(system_names[k], /*localize_data*/ false);
+    }
+    if (localize_data) localizeGhostedVectors(sol_vecs, ghost_vecs);
+    return;
+} // buildGhostedSolutionVectors
+
+void
+FEDataManager::localizeGhostedVectors(const std::vector<NumericVector<double>*>& vecs,
+                                      const std::vector<NumericVector<double>*>& ghost_vecs)
+{
+    IBTK_TIMER_START(t_localize_ghosted_vectors);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(vecs.size() == ghost_vecs.size());
+#endif
+    int ierr;
+
+    // Determine which ghosted vectors are out of date.  A ghosted vector is
+    // current if it was last localized from the same vector and neither vector
+    // has been modified since then.  Neither vector is closed in that case.
+    //
+    // NOTE: This check does not require any communication.  FE vectors are only
+    // modified by operations that are performed by all MPI processes (e.g.,
+    // PETSc Vec operations or libMesh assembly followed by close()), so that
+    // all processes reach the same conclusion.
+    std::vector<int> is_stale(vecs.size(), 0);
+    for (unsigned int k = 0; k < vecs.size(); ++k)
+    {
+        Vec vec = static_cast<PetscVector<double>*>(vecs[k])->vec();
+        Vec ghost_vec = static_cast<PetscVector<double>*>(ghost_vecs[k])->vec();
+        PetscObjectId vec_id, ghost_vec_id;
+        PetscObjectState vec_state, ghost_vec_state;
+        ierr = PetscObjectGetId(reinterpret_cast<PetscObject>(vec), &vec_id);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(vec), &vec_state);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectGetId(reinterpret_cast<PetscObject>(ghost_vec), &ghost_vec_id);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(ghost_vec), &ghost_vec_state);
+        IBTK_CHKERRQ(ierr);
+        std::map<PetscObjectId, GhostVecLocalizationRecord>::const_iterator it =
+            d_ghost_vec_localization_records.find(ghost_vec_id);
+        is_stale[k] = !(it != d_ghost_vec_localization_records.end() && it->second.vec_id == vec_id &&
+                        it->second.vec_state == vec_state && it->second.ghost_vec_state == ghost_vec_state);
+    }
+    const unsigned int num_stale = static_cast<unsigned int>(std::count(is_stale.begin(), is_stale.end(), 1));
+    d_num_ghost_vec_localizations += num_stale;
+    d_num_skipped_ghost_vec_localizations += static_cast<unsigned int>(vecs.size()) - num_stale;
+
+    // Copy the locally owned values of each out-of-date ghosted vector.
+    std::vector<unsigned int> stale_idxs;
+    stale_idxs.reserve(vecs.size());
+    for (unsigned int k = 0; k < vecs.size(); ++k)
+    {
+        if (!is_stale[k]) continue;
+        vecs[k]->close();
+        Vec vec = static_cast<PetscVector<double>*>(vecs[k])->vec();
+        Vec ghost_vec = static_cast<PetscVector<double>*>(ghost_vecs[k])->vec();
+        ierr = VecCopy(vec, ghost_vec);
+        IBTK_CHKERRQ(ierr);
+        stale_idxs.push_back(k);
+    }
+
+    // Update the ghost values of all of the out-of-date vectors at once.
+    for (unsigned int j = 0; j < stale_idxs.size(); ++j)
+    {
+        Vec ghost_vec = static_cast<PetscVector<double>*>(ghost_vecs[stale_idxs[j]])->vec();
+        ierr = VecGhostUpdateBegin(ghost_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+    }
+    for (unsigned int j = 0; j < stale_idxs.size(); ++j)
+    {
+        Vec ghost_vec = static_cast<PetscVector<double>*>(ghost_vecs[stale_idxs[j]])->vec();
+        ierr = VecGhostUpdateEnd(ghost_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Record the states of the updated vectors.
+    for (unsigned int j = 0; j < stale_idxs.size(); ++j)
+    {
+        Vec vec = static_cast<PetscVector<double>*>(vecs[stale_idxs[j]])->vec();
+        Vec ghost_vec = static_cast<PetscVector<double>*>(ghost_vecs[stale_idxs[j]])->vec();
+        PetscObjectId ghost_vec_id;
+        ierr = PetscObjectGetId(reinterpret_cast<PetscObject>(ghost_vec), &ghost_vec_id);
+        IBTK_CHKERRQ(ierr);
+        GhostVecLocalizationRecord& record = d_ghost_vec_localization_records[ghost_vec_id];
+        ierr = PetscObjectGetId(reinterpret_cast<PetscObject>(vec), &record.vec_id);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(vec), &record.vec_state);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(ghost_vec), &record.ghost_vec_state);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    IBTK_TIMER_STOP(t_localize_ghosted_vectors);
+    return;
+} // localizeGhostedVectors
+
+void
+FEDataManager::printLocalizationStatistics(std::ostream& os) const
+{
+    os << d_object_name << "::printLocalizationStatistics(): ghosted vectors localized: "
+       << d_num_ghost_vec_localizations << "  localizations skipped: " << d_num_skipped_ghost_vec_localizations
+       << "\n";
+    return;
+} // printLocalizationStatistics
+
+void
+FEDataManager::resetLocalizationStatistics()
+{
+    d_num_ghost_vec_localizations = 0;
+    d_num_skipped_ghost_vec_localizations = 0;
+    return;
+} // resetLocalizationStatistics
+
 NumericVector<double>*
 FEDataManager::getCoordsVector() const
 {
@@ -500,8 +1088,10 @@ FEDataManager::spread(const int f_data_idx,
     Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
     Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
     const bool cc_data = f_cc_var;
+#if !defined(NDEBUG)
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
+#endif
 
     // Make a copy of the Eulerian data.
     const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
@@ -526,7 +1116,6 @@ FEDataManager::spread(const int f_data_idx,
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
     const DofMap& X_dof_map = X_system.get_dof_map();
-    std::vector<std::vector<unsigned int> > F_dof_indices(n_vars);
     std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
     FEType F_fe_type = F_dof_map.variable_type(0);
     for (unsigned i = 0; i < n_vars; ++i) TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
@@ -539,49 +1128,87 @@ FEDataManager::spread(const int f_data_idx,
     }
     FEBase* F_fe = F_fe_autoptr.get();
     FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
-    /*if (!F_vec.closed())*/ F_vec.close();
+    closeGhostedVector(F_vec);
     PetscVector<double>* F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec);
     Vec F_global_vec = F_petsc_vec->vec();
     Vec F_local_vec;
     VecGhostGetLocalForm(F_global_vec, &F_local_vec);
-    double* F_local_soln;
-    VecGetArray(F_local_vec, &F_local_soln);
+    const double* F_local_soln;
+    VecGetArrayRead(F_local_vec, &F_local_soln);
 
-    /*if (!X_vec.closed())*/ X_vec.close();
+    closeGhostedVector(X_vec);
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
     VecGhostGetLocalForm(X_global_vec, &X_local_vec);
-    double* X_local_soln;
-    VecGetArray(X_local_vec, &X_local_soln);
+    const double* X_local_soln;
+    VecGetArrayRead(X_local_vec, &X_local_soln);
 
     // Loop over the patches to interpolate nodal values on the FE mesh to the
-    // element quadrature points, then spread those values onto the Eulerian
-    // grid.
-    boost::multi_array<double, 2> F_node, X_node;
-    std::vector<double> F_JxW_qp, X_qp;
+    // element quadrature points.  The values are stored for all local patches
+    // so that they may subsequently be spread onto the Eulerian grid
+    // concurrently.
+    boost::multi_array<double, 2> X_node;
+    std::vector<unsigned int> elem_qp_offset;
+    std::vector<const std::vector<std::vector<double> >*> elem_phi_F, elem_phi_X;
+    std::vector<const std::vector<double>*> elem_JxW_F;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
+    const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
+    std::vector<Pointer<Patch<NDIM> > > patches(num_local_patches);
+    std::vector<Pointer<PatchData<NDIM> > > f_patch_data(num_local_patches);
+    std::vector<Pointer<CartesianPatchGeometry<NDIM> > > patch_geom_ptrs(num_local_patches);
+    std::vector<const CartesianPatchGeometry<NDIM>*> patch_geoms(num_local_patches, NULL);
+    std::vector<const Box<NDIM>*> patch_boxes(num_local_patches, NULL);
+    std::vector<CellData<NDIM, double>*> f_cc_patch_data(num_local_patches, NULL);
+    std::vector<SideData<NDIM, double>*> f_sc_patch_data(num_local_patches, NULL);
+    std::vector<std::vector<double> > F_JxW_qp(num_local_patches), X_qp(num_local_patches);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        patches[local_patch_num] = patch;
+        f_patch_data[local_patch_num] = patch->getPatchData(f_data_idx);
+
+        // Extract raw pointers to the patch objects for use by the threaded
+        // spreading loop below.
+        patch_geom_ptrs[local_patch_num] = patch->getPatchGeometry();
+        patch_geoms[local_patch_num] = patch_geom_ptrs[local_patch_num].getPointer();
+        patch_boxes[local_patch_num] = &patch->getBox();
+        if (cc_data)
+        {
+            Pointer<CellData<NDIM, double> > f_cc_data = f_patch_data[local_patch_num];
+            f_cc_patch_data[local_patch_num] = f_cc_data.getPointer();
+        }
+        else
+        {
+            Pointer<SideData<NDIM, double> > f_sc_data = f_patch_data[local_patch_num];
+            f_sc_patch_data[local_patch_num] = f_sc_data.getPointer();
+        }
+
         // The relevant collection of elements.
         const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
         const size_t num_active_patch_elems = patch_elems.size();
         if (!num_active_patch_elems) continue;
 
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-        const double* const patch_dx = patch_geom->getDx();
+        const double* const patch_dx = patch_geoms[local_patch_num]->getDx();
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-        // Setup vectors to store the values of F_JxW and X at the quadrature
-        // points.
+        // Determine the quadrature rule to use on each element and setup
+        // vectors to store the values of F_JxW and X at the quadrature points.
+        //
+        // NOTE: The shape function values depend only on the element type and
+        // quadrature rule, and the JxW values are computed with respect to the
+        // reference configuration of the element.  Both are cached, so that
+        // only the physical positions of the quadrature points need to be
+        // recomputed below.  The cache lookups may modify the caches, and so
+        // this pass is performed serially.
+        elem_qp_offset.resize(num_active_patch_elems + 1);
+        elem_phi_F.resize(num_active_patch_elems);
+        elem_phi_X.resize(num_active_patch_elems);
+        elem_JxW_F.resize(num_active_patch_elems);
         unsigned int n_qp_patch = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -592,92 +1219,72 @@ FEDataManager::spread(const int f_data_idx,
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
             const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
+            // NOTE: The rule is reinitialized whenever the element type or
+            // p-level differs from the one for which it was last initialized,
+            // even if its order is unchanged, because the number and locations
+            // of the quadrature points depend on the element type.
+            if (qrule_needs_reinit || qrule->get_elem_type() != elem->type() ||
+                qrule->get_p_level() != elem->p_level())
             {
                 qrule->init(elem->type(), elem->p_level());
             }
+            elem_qp_offset[e_idx] = n_qp_patch;
+            elem_phi_F[e_idx] = &getCachedPhi(F_fe, qrule.get(), elem);
+            elem_phi_X[e_idx] = X_fe != F_fe ? &getCachedPhi(X_fe, qrule.get(), elem) : elem_phi_F[e_idx];
+            elem_JxW_F[e_idx] = &getCachedJxW(F_fe, qrule.get(), elem);
             n_qp_patch += qrule->n_points();
         }
+        elem_qp_offset[num_active_patch_elems] = n_qp_patch;
+        d_num_spread_qps += n_qp_patch;
         if (!n_qp_patch) continue;
-        F_JxW_qp.resize(n_vars * n_qp_patch);
-        X_qp.resize(NDIM * n_qp_patch);
+        F_JxW_qp[local_patch_num].resize(n_vars * n_qp_patch);
+        X_qp[local_patch_num].resize(NDIM * n_qp_patch);
 
         // Loop over the elements and compute the values to be spread and the
-        // positions of the quadrature points.
-        qrule.reset();
-        unsigned int qp_offset = 0;
-        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-        {
-            Elem* const elem = patch_elems[e_idx];
-            for (unsigned int i = 0; i < n_vars; ++i)
-            {
-                F_dof_map.dof_indices(elem, F_dof_indices[i], i);
-            }
-            get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-            }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
-                if (X_fe != F_fe) X_fe->reinit(elem);
-            }
-            F_fe->reinit(elem);
-            const unsigned int n_node = elem->n_nodes();
-            const unsigned int n_qp = qrule->n_points();
-            double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-            double* X_begin = &X_qp[NDIM * qp_offset];
-            std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-            std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-            for (unsigned int k = 0; k < n_node; ++k)
-            {
-                for (unsigned int qp = 0; qp < n_qp; ++qp)
-                {
-                    const double p_JxW_F = phi_F[k][qp] * JxW_F[qp];
-                    for (unsigned int i = 0; i < n_vars; ++i)
-                    {
-                        F_JxW_qp[n_vars * (qp_offset + qp) + i] += F_node[k][i] * p_JxW_F;
-                    }
-                    const double& p_X = phi_X[k][qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        X_qp[NDIM * (qp_offset + qp) + i] += X_node[k][i] * p_X;
-                    }
-                }
-            }
-            qp_offset += n_qp;
-        }
+        // positions of the quadrature points.  The loop is executed by the
+        // libMesh thread pool when libMesh is configured with threads.
+        ComputeQuadraturePointValues compute_qp_values(&F_JxW_qp[local_patch_num][0],
+                                                       &X_qp[local_patch_num][0],
+                                                       patch_elems,
+                                                       elem_qp_offset,
+                                                       elem_phi_F,
+                                                       elem_phi_X,
+                                                       elem_JxW_F,
+                                                       n_vars,
+                                                       &F_dof_map,
+                                                       F_petsc_vec,
+                                                       F_local_soln,
+                                                       X_dof_map,
+                                                       *X_petsc_vec,
+                                                       X_local_soln);
+        libMesh::Threads::parallel_for(
+            libMesh::Threads::BlockedRange<int>(0, static_cast<int>(num_active_patch_elems), ELEM_GRAIN_SIZE),
+            compute_qp_values);
+    }
 
-        // Spread values from the quadrature points to the Cartesian grid patch.
-        //
-        // NOTE: Values are spread only from those quadrature points that are
-        // within the ghost cell width of the patch interior.
-        const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), d_ghost_width);
-        Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-        if (cc_data)
-        {
-            Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
-        }
-        if (sc_data)
-        {
-            Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
-        }
-        if (f_phys_bdry_op)
+    // Spread values from the quadrature points to the Cartesian grid patches.
+    //
+    // NOTE: Distinct patches own distinct patch data, and so the patches may
+    // be processed concurrently.
+    SpreadPatchValues spread_patch_values(patch_geoms,
+                                          patch_boxes,
+                                          f_cc_patch_data,
+                                          f_sc_patch_data,
+                                          F_JxW_qp,
+                                          X_qp,
+                                          n_vars,
+                                          d_ghost_width,
+                                          spread_spec.kernel_fcn);
+    libMesh::Threads::parallel_for(libMesh::Threads::BlockedRange<int>(0, num_local_patches, PATCH_GRAIN_SIZE),
+                                   spread_patch_values);
+    if (f_phys_bdry_op)
+    {
+        f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+        for (int k = 0; k < num_local_patches; ++k)
         {
-            f_phys_bdry_op->setPatchDataIndex(f_data_idx);
-            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
+            if (X_qp[k].empty()) continue;
+            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(
+                *patches[k], fill_data_time, f_patch_data[k]->getGhostCellWidth());
         }
     }
 
@@ -691,10 +1298,10 @@ FEDataManager::spread(const int f_data_idx,
     }
     var_db->removePatchDataIndex(f_copy_data_idx);
 
-    VecRestoreArray(F_local_vec, &F_local_soln);
+    VecRestoreArrayRead(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
 
-    VecRestoreArray(X_local_vec, &X_local_soln);
+    VecRestoreArrayRead(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
     IBTK_TIMER_STOP(t_spread);
@@ -754,21 +1361,21 @@ FEDataManager::prolongData(const int f_data_idx,
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
-    /*if (!F_vec.closed())*/ F_vec.close();
+    closeGhostedVector(F_vec);
     PetscVector<double>* F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec);
     Vec F_global_vec = F_petsc_vec->vec();
     Vec F_local_vec;
     VecGhostGetLocalForm(F_global_vec, &F_local_vec);
-    double* F_local_soln;
-    VecGetArray(F_local_vec, &F_local_soln);
+    const double* F_local_soln;
+    VecGetArrayRead(F_local_vec, &F_local_soln);
 
-    /*if (!X_vec.closed())*/ X_vec.close();
+    closeGhostedVector(X_vec);
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
     VecGhostGetLocalForm(X_global_vec, &X_local_vec);
-    double* X_local_soln;
-    VecGetArray(X_local_vec, &X_local_soln);
+    const double* X_local_soln;
+    VecGetArrayRead(X_local_vec, &X_local_soln);
 
     // Loop over the patches to interpolate nodal values on the FE mesh to the
     // points of the Eulerian grid.
@@ -909,10 +1516,10 @@ FEDataManager::prolongData(const int f_data_idx,
         }
     }
 
-    VecRestoreArray(F_local_vec, &F_local_soln);
+    VecRestoreArrayRead(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
 
-    VecRestoreArray(X_local_vec, &X_local_soln);
+    VecRestoreArrayRead(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
     IBTK_TIMER_STOP(t_prolong_data);
@@ -964,7 +1571,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
     const DofMap& X_dof_map = X_system.get_dof_map();
-    std::vector<std::vector<unsigned int> > F_dof_indices(n_vars);
     std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
     FEType F_fe_type = F_dof_map.variable_type(0);
     for (unsigned i = 0; i < n_vars; ++i) TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
@@ -977,9 +1583,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     }
     FEBase* F_fe = F_fe_autoptr.get();
     FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
@@ -988,21 +1591,24 @@ FEDataManager::interpWeighted(const int f_data_idx,
         if (f_refine_scheds[k]) f_refine_scheds[k]->fillData(fill_data_time);
     }
 
-    /*if (!X_vec.closed())*/ X_vec.close();
+    closeGhostedVector(X_vec);
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
     VecGhostGetLocalForm(X_global_vec, &X_local_vec);
-    double* X_local_soln;
-    VecGetArray(X_local_vec, &X_local_soln);
+    const double* X_local_soln;
+    VecGetArrayRead(X_local_vec, &X_local_soln);
 
     // Loop over the patches to interpolate values to the element quadrature
     // points from the grid, then use these values to compute the projection of
     // the interpolated velocity field onto the FE basis functions.
     F_vec.zero();
-    std::vector<DenseVector<double> > F_rhs_e(n_vars);
+    libMesh::Threads::spin_mutex F_vec_mutex;
     boost::multi_array<double, 2> X_node;
     std::vector<double> F_qp, X_qp;
+    std::vector<unsigned int> elem_qp_offset;
+    std::vector<const std::vector<std::vector<double> >*> elem_phi_F, elem_phi_X;
+    std::vector<const std::vector<double>*> elem_JxW_F;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -1017,8 +1623,15 @@ FEDataManager::interpWeighted(const int f_data_idx,
         const double* const patch_dx = patch_geom->getDx();
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-        // Setup vectors to store the values of F and X at the quadrature
-        // points.
+        // Determine the quadrature rule to use on each element and setup
+        // vectors to store the values of F and X at the quadrature points.
+        //
+        // NOTE: The cache lookups may modify the caches, and so this pass is
+        // performed serially.
+        elem_qp_offset.resize(num_active_patch_elems + 1);
+        elem_phi_F.resize(num_active_patch_elems);
+        elem_phi_X.resize(num_active_patch_elems);
+        elem_JxW_F.resize(num_active_patch_elems);
         unsigned int n_qp_patch = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1029,57 +1642,48 @@ FEDataManager::interpWeighted(const int f_data_idx,
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
             const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
+            // NOTE: The rule is reinitialized whenever the element type or
+            // p-level differs from the one for which it was last initialized,
+            // even if its order is unchanged, because the number and locations
+            // of the quadrature points depend on the element type.
+            if (qrule_needs_reinit || qrule->get_elem_type() != elem->type() ||
+                qrule->get_p_level() != elem->p_level())
             {
                 qrule->init(elem->type(), elem->p_level());
             }
+            elem_qp_offset[e_idx] = n_qp_patch;
+            elem_phi_F[e_idx] = &getCachedPhi(F_fe, qrule.get(), elem);
+            elem_phi_X[e_idx] = X_fe != F_fe ? &getCachedPhi(X_fe, qrule.get(), elem) : elem_phi_F[e_idx];
+            elem_JxW_F[e_idx] = &getCachedJxW(F_fe, qrule.get(), elem);
             n_qp_patch += qrule->n_points();
         }
+        elem_qp_offset[num_active_patch_elems] = n_qp_patch;
+        d_num_interp_qps += n_qp_patch;
         if (!n_qp_patch) continue;
         F_qp.resize(n_vars * n_qp_patch);
         X_qp.resize(NDIM * n_qp_patch);
         std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
-        // Loop over the elements and compute the positions of the quadrature points.
-        qrule.reset();
-        unsigned int qp_offset = 0;
-        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-        {
-            Elem* const elem = patch_elems[e_idx];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-            }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                X_fe->attach_quadrature_rule(qrule.get());
-                X_fe->reinit(elem);
-            }
-            const unsigned int n_node = elem->n_nodes();
-            const unsigned int n_qp = qrule->n_points();
-            double* X_begin = &X_qp[NDIM * qp_offset];
-            std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-            for (unsigned int k = 0; k < n_node; ++k)
-            {
-                for (unsigned int qp = 0; qp < n_qp; ++qp)
-                {
-                    const double& p_X = phi_X[k][qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        X_qp[NDIM * (qp_offset + qp) + i] += X_node[k][i] * p_X;
-                    }
-                }
-            }
-            qp_offset += n_qp;
-        }
+        // Loop over the elements and compute the positions of the quadrature
+        // points.  The loop is executed by the libMesh thread pool when libMesh
+        // is configured with threads.
+        ComputeQuadraturePointValues compute_qp_positions(/*F_JxW_qp*/ NULL,
+                                                          &X_qp[0],
+                                                          patch_elems,
+                                                          elem_qp_offset,
+                                                          elem_phi_F,
+                                                          elem_phi_X,
+                                                          elem_JxW_F,
+                                                          n_vars,
+                                                          /*F_dof_map*/ NULL,
+                                                          /*F_petsc_vec*/ NULL,
+                                                          /*F_local_soln*/ NULL,
+                                                          X_dof_map,
+                                                          *X_petsc_vec,
+                                                          X_local_soln);
+        const libMesh::Threads::BlockedRange<int> elem_range(
+            0, static_cast<int>(num_active_patch_elems), ELEM_GRAIN_SIZE);
+        libMesh::Threads::parallel_for(elem_range, compute_qp_positions);
 
         // Interpolate values from the Cartesian grid patch to the quadrature
         // points.
@@ -1100,60 +1704,13 @@ FEDataManager::interpWeighted(const int f_data_idx,
         }
 
         // Loop over the elements and accumulate the right-hand-side values.
-        qrule.reset();
-        qp_offset = 0;
-        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-        {
-            Elem* const elem = patch_elems[e_idx];
-            for (unsigned int i = 0; i < n_vars; ++i)
-            {
-                F_dof_map.dof_indices(elem, F_dof_indices[i], i);
-                F_rhs_e[i].resize(static_cast<int>(F_dof_indices[i].size()));
-            }
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-            }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
-                if (X_fe != F_fe) X_fe->reinit(elem);
-            }
-            F_fe->reinit(elem);
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = F_dof_indices[0].size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
-            {
-                const int idx = n_vars * (qp_offset + qp);
-                for (unsigned int k = 0; k < n_basis; ++k)
-                {
-                    const double p_JxW_F = phi_F[k][qp] * JxW_F[qp];
-                    for (unsigned int i = 0; i < n_vars; ++i)
-                    {
-                        F_rhs_e[i](k) += F_qp[idx + i] * p_JxW_F;
-                    }
-                }
-            }
-            for (unsigned int i = 0; i < n_vars; ++i)
-            {
-                F_dof_map.constrain_element_vector(F_rhs_e[i], F_dof_indices[i]);
-                F_vec.add_vector(F_rhs_e[i], F_dof_indices[i]);
-            }
-            qp_offset += n_qp;
-        }
+        AccumulateElementRHS accumulate_elem_rhs(
+            F_vec, F_vec_mutex, &F_qp[0], patch_elems, elem_qp_offset, elem_phi_F, elem_JxW_F, n_vars, F_dof_map);
+        libMesh::Threads::parallel_for(elem_range, accumulate_elem_rhs);
     }
     F_vec.close();
 
-    VecRestoreArray(X_local_vec, &X_local_soln);
+    VecRestoreArrayRead(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
     IBTK_TIMER_STOP(t_interp_weighted);
@@ -1245,13 +1802,13 @@ FEDataManager::restrictData(const int f_data_idx,
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
-    /*if (!X_vec.closed())*/ X_vec.close();
+    closeGhostedVector(X_vec);
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
     VecGhostGetLocalForm(X_global_vec, &X_local_vec);
-    double* X_local_soln;
-    VecGetArray(X_local_vec, &X_local_soln);
+    const double* X_local_soln;
+    VecGetArrayRead(X_local_vec, &X_local_soln);
 
     // Loop over the patches to assemble the right-hand-side vector used to
     // solve for F.
@@ -1400,7 +1957,7 @@ FEDataManager::restrictData(const int f_data_idx,
         }
     }
 
-    VecRestoreArray(X_local_vec, &X_local_soln);
+    VecRestoreArrayRead(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
     // Solve for the nodal values.
@@ -1417,8 +1974,13 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
 {
     IBTK_TIMER_START(t_build_l2_projection_solver);
 
-    if (!d_L2_proj_solver.count(system_name) || !d_L2_proj_matrix.count(system_name) ||
-        (d_L2_proj_quad_type[system_name] != quad_type) || (d_L2_proj_quad_order[system_name] != quad_order))
+    // Solvers are cached for each combination of system and quadrature rule
+    // within this FEDataManager (i.e., within a single part), so that systems
+    // that use different quadrature rules do not force repeated reassembly of
+    // the mass matrix.  Because the mesh topology is fixed, the mass matrix and
+    // its preconditioner remain valid for the lifetime of the FEDataManager.
+    const L2ProjectionSolverKey key(system_name, std::make_pair(quad_type, quad_order));
+    if (!d_L2_proj_solver.count(key) || !d_L2_proj_matrix.count(key))
     {
         plog << "FEDataManager::buildL2ProjectionSolver(): building L2 projection solver for "
                 "system: "
@@ -1442,8 +2004,14 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
         const std::vector<double>& JxW = fe->get_JxW();
         const std::vector<std::vector<double> >& phi = fe->get_phi();
 
-        // Build solver components.
+        // Build solver components.  The mass matrix is symmetric positive
+        // definite, so we use CG preconditioned by block Jacobi with an
+        // incomplete factorization on each block.  The factorization is
+        // computed once and reused for all subsequent solves.  These defaults
+        // may be overridden at runtime via PETSc options.
         LinearSolver<double>* solver = LinearSolver<double>::build(comm).release();
+        solver->set_solver_type(CG);
+        solver->set_preconditioner_type(BLOCK_JACOBI_PRECOND);
         solver->init();
 
         SparseMatrix<double>* M_mat = SparseMatrix<double>::build(comm).release();
@@ -1532,15 +2100,13 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
         // Setup the solver.
         solver->reuse_preconditioner(true);
 
-        // Store the solver, mass matrix, and configuration options.
-        d_L2_proj_solver[system_name] = solver;
-        d_L2_proj_matrix[system_name] = M_mat;
-        d_L2_proj_quad_type[system_name] = quad_type;
-        d_L2_proj_quad_order[system_name] = quad_order;
+        // Store the solver and mass matrix.
+        d_L2_proj_solver[key] = solver;
+        d_L2_proj_matrix[key] = M_mat;
     }
 
     IBTK_TIMER_STOP(t_build_l2_projection_solver);
-    return std::make_pair(d_L2_proj_solver[system_name], d_L2_proj_matrix[system_name]);
+    return std::make_pair(d_L2_proj_solver[key], d_L2_proj_matrix[key]);
 } // buildL2ProjectionSolver
 
 NumericVector<double>*
@@ -1695,17 +2261,40 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                    const Order quad_order,
                                    const double tol,
                                    const unsigned int max_its)
+{
+    std::vector<NumericVector<double>*> U_vecs(1, &U_vec), F_vecs(1, &F_vec);
+    return computeL2Projection(
+        U_vecs, F_vecs, system_name, consistent_mass_matrix, quad_type, quad_order, tol, max_its);
+} // computeL2Projection
+
+bool
+FEDataManager::computeL2Projection(const std::vector<NumericVector<double>*>& U_vecs,
+                                   const std::vector<NumericVector<double>*>& F_vecs,
+                                   const std::string& system_name,
+                                   const bool consistent_mass_matrix,
+                                   const QuadratureType quad_type,
+                                   const Order quad_order,
+                                   const double tol,
+                                   const unsigned int max_its)
 {
     IBTK_TIMER_START(t_compute_l2_projection);
 
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_vecs.size() == F_vecs.size());
+#endif
     int ierr;
-    bool converged = false;
+    bool converged = true;
+    L2ProjectionStatistics& stats = d_L2_proj_stats[system_name];
+    const double start_time = MPI_Wtime();
 
-    /*if (!F_vec.closed())*/ F_vec.close();
     const System& system = d_es->get_system(system_name);
     const DofMap& dof_map = system.get_dof_map();
     if (consistent_mass_matrix)
     {
+        // The solver, mass matrix, and preconditioner are set up once and then
+        // reused for each right-hand side.  Because the solver is built with
+        // reuse_preconditioner(true), the incomplete factorization is computed
+        // only for the first solve.
         std::pair<libMesh::LinearSolver<double>*, SparseMatrix<double>*> proj_solver_components =
             buildL2ProjectionSolver(system_name, quad_type, quad_order);
         PetscLinearSolver<double>* solver = static_cast<PetscLinearSolver<double>*>(proj_solver_components.first);
@@ -1720,30 +2309,88 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
         IBTK_CHKERRQ(ierr);
         ierr = KSPSetFromOptions(solver->ksp());
         IBTK_CHKERRQ(ierr);
-        solver->solve(
-            *M_mat, *M_mat, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
-        KSPConvergedReason reason;
-        ierr = KSPGetConvergedReason(solver->ksp(), &reason);
-        IBTK_CHKERRQ(ierr);
-        converged = reason > 0;
+        for (unsigned int k = 0; k < U_vecs.size(); ++k)
+        {
+            NumericVector<double>& U_vec = *U_vecs[k];
+            NumericVector<double>& F_vec = *F_vecs[k];
+            /*if (!F_vec.closed())*/ F_vec.close();
+            const std::pair<unsigned int, double> solve_info = solver->solve(
+                *M_mat, *M_mat, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
+            KSPConvergedReason reason;
+            ierr = KSPGetConvergedReason(solver->ksp(), &reason);
+            IBTK_CHKERRQ(ierr);
+            converged = converged && (reason > 0);
+            stats.num_iterations += solve_info.first;
+            U_vec.close();
+            dof_map.enforce_constraints_exactly(system, &U_vec);
+        }
     }
     else
     {
         PetscVector<double>* M_diag_vec = static_cast<PetscVector<double>*>(buildDiagonalL2MassMatrix(system_name));
         Vec M_diag_petsc_vec = M_diag_vec->vec();
-        Vec U_petsc_vec = static_cast<PetscVector<double>*>(&U_vec)->vec();
-        Vec F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec)->vec();
-        ierr = VecPointwiseDivide(U_petsc_vec, F_petsc_vec, M_diag_petsc_vec);
-        IBTK_CHKERRQ(ierr);
-        converged = true;
+        for (unsigned int k = 0; k < U_vecs.size(); ++k)
+        {
+            NumericVector<double>& U_vec = *U_vecs[k];
+            NumericVector<double>& F_vec = *F_vecs[k];
+            /*if (!F_vec.closed())*/ F_vec.close();
+            Vec U_petsc_vec = static_cast<PetscVector<double>*>(&U_vec)->vec();
+            Vec F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec)->vec();
+            ierr = VecPointwiseDivide(U_petsc_vec, F_petsc_vec, M_diag_petsc_vec);
+            IBTK_CHKERRQ(ierr);
+            U_vec.close();
+            dof_map.enforce_constraints_exactly(system, &U_vec);
+        }
     }
-    U_vec.close();
-    dof_map.enforce_constraints_exactly(system, &U_vec);
+    stats.num_solves += static_cast<unsigned int>(U_vecs.size());
+    stats.solve_time += MPI_Wtime() - start_time;
 
     IBTK_TIMER_STOP(t_compute_l2_projection);
     return converged;
 } // computeL2Projection
 
+void
+FEDataManager::printL2ProjectionStatistics(std::ostream& os) const
+{
+    for (std::map<std::string, L2ProjectionStatistics>::const_iterator it = d_L2_proj_stats.begin();
+         it != d_L2_proj_stats.end();
+         ++it)
+    {
+        const L2ProjectionStatistics& stats = it->second;
+        if (stats.num_solves == 0) continue;
+        os << d_object_name << "::printL2ProjectionStatistics(): system: " << it->first
+           << "  solves: " << stats.num_solves << "  iterations: " << stats.num_iterations
+           << "  time: " << stats.solve_time << " s\n";
+    }
+    return;
+} // printL2ProjectionStatistics
+
+void
+FEDataManager::resetL2ProjectionStatistics()
+{
+    d_L2_proj_stats.clear();
+    return;
+} // resetL2ProjectionStatistics
+
+void
+FEDataManager::printQuadratureStatistics(std::ostream& os) const
+{
+    double num_qps[2] = { static_cast<double>(d_num_spread_qps), static_cast<double>(d_num_interp_qps) };
+    SAMRAI_MPI::sumReduction(num_qps, 2);
+    os << d_object_name << "::printQuadratureStatistics(): spread quadrature points: "
+       << static_cast<unsigned long>(num_qps[0])
+       << "  interp quadrature points: " << static_cast<unsigned long>(num_qps[1]) << "\n";
+    return;
+} // printQuadratureStatistics
+
+void
+FEDataManager::resetQuadratureStatistics()
+{
+    d_num_spread_qps = 0;
+    d_num_interp_qps = 0;
+    return;
+} // resetQuadratureStatistics
+
 bool
 FEDataManager::updateQuadratureRule(AutoPtr<QBase>& qrule,
                                     QuadratureType type,
@@ -1752,12 +2399,24 @@ FEDataManager::updateQuadratureRule(AutoPtr<QBase>& qrule,
                                     double point_density,
                                     Elem* const elem,
                                     const boost::multi_array<double, 2>& X_node,
-                                    const double dx_min)
+                                    const double dx_min,
+                                    const bool use_strain_indicator,
+                                    const double min_point_density,
+                                    const double strain_threshold)
 {
     unsigned int dim = elem->dim();
     if (use_adaptive_quadrature)
     {
-        const double hmax = get_elem_hmax(elem, X_node);
+        double max_edge_strain = 0.0;
+        const double hmax = get_elem_hmax(elem, X_node, use_strain_indicator ? &max_edge_strain : NULL);
+        if (use_strain_indicator && min_point_density < point_density)
+        {
+            // Use the reduced point density for undeformed elements, and
+            // increase it linearly with the edge strain up to the full point
+            // density.
+            const double alpha = strain_threshold > 0.0 ? std::min(1.0, max_edge_strain / strain_threshold) : 1.0;
+            point_density = min_point_density + alpha * (point_density - min_point_density);
+        }
         const int min_pts = elem->default_order() == FIRST ? 2 : 3;
         const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
         switch (type)
@@ -1794,8 +2453,17 @@ FEDataManager::updateInterpQuadratureRule(AutoPtr<QBase>& qrule,
                                           const boost::multi_array<double, 2>& X_node,
                                           const double dx_min)
 {
-    return updateQuadratureRule(
-        qrule, spec.quad_type, spec.quad_order, spec.use_adaptive_quadrature, spec.point_density, elem, X_node, dx_min);
+    return updateQuadratureRule(qrule,
+                                spec.quad_type,
+                                spec.quad_order,
+                                spec.use_adaptive_quadrature,
+                                spec.point_density,
+                                elem,
+                                X_node,
+                                dx_min,
+                                spec.use_strain_indicator,
+                                spec.min_point_density,
+                                spec.strain_threshold);
 }
 
 bool
@@ -1805,10 +2473,52 @@ FEDataManager::updateSpreadQuadratureRule(AutoPtr<QBase>& qrule,
                                           const boost::multi_array<double, 2>& X_node,
                                           const double dx_min)
 {
-    return updateQuadratureRule(
-        qrule, spec.quad_type, spec.quad_order, spec.use_adaptive_quadrature, spec.point_density, elem, X_node, dx_min);
+    return updateQuadratureRule(qrule,
+                                spec.quad_type,
+                                spec.quad_order,
+                                spec.use_adaptive_quadrature,
+                                spec.point_density,
+                                elem,
+                                X_node,
+                                dx_min,
+                                spec.use_strain_indicator,
+                                spec.min_point_density,
+                                spec.strain_threshold);
 }
 
+const std::vector<std::vector<double> >&
+FEDataManager::getCachedPhi(FEBase* const fe, QBase* const qrule, const Elem* const elem)
+{
+    const QuadratureCacheKey key = { elem->type(), elem->p_level(), qrule->type(), qrule->get_order() };
+    const std::pair<FEType, QuadratureCacheKey> phi_key(fe->get_fe_type(), key);
+    std::map<std::pair<FEType, QuadratureCacheKey>, std::vector<std::vector<double> > >::iterator it =
+        d_phi_cache.find(phi_key);
+    if (it != d_phi_cache.end()) return it->second;
+
+    // NOTE: The shape function values depend only on the element type and
+    // quadrature rule, not on the element geometry.
+    const std::vector<std::vector<double> >& phi = fe->get_phi();
+    fe->attach_quadrature_rule(qrule);
+    fe->reinit(elem);
+    return d_phi_cache[phi_key] = phi;
+} // getCachedPhi
+
+const std::vector<double>&
+FEDataManager::getCachedJxW(FEBase* const fe, QBase* const qrule, const Elem* const elem)
+{
+    const QuadratureCacheKey key = { elem->type(), elem->p_level(), qrule->type(), qrule->get_order() };
+    std::pair<QuadratureCacheKey, std::vector<double> >& entry = d_JxW_cache[elem->id()];
+    if (entry.second.empty() || key < entry.first || entry.first < key)
+    {
+        const std::vector<double>& JxW = fe->get_JxW();
+        fe->attach_quadrature_rule(qrule);
+        fe->reinit(elem);
+        entry.first = key;
+        entry.second = JxW;
+    }
+    return entry.second;
+} // getCachedJxW
+
 void
 FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2059,11 +2769,16 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_es(NULL),
       d_level_number(-1),
       d_active_patch_ghost_dofs(),
+      d_system_ghost_vec(),
+      d_ghost_vec_localization_records(),
+      d_num_ghost_vec_localizations(0),
+      d_num_skipped_ghost_vec_localizations(0),
       d_L2_proj_solver(),
       d_L2_proj_matrix(),
       d_L2_proj_matrix_diag(),
-      d_L2_proj_quad_type(),
-      d_L2_proj_quad_order()
+      d_L2_proj_stats(),
+      d_num_spread_qps(0),
+      d_num_interp_qps(0)
 {
     TBOX_ASSERT(!object_name.empty());
 
@@ -2090,8 +2805,11 @@ FEDataManager::FEDataManager(const std::string& object_name,
     IBTK_DO_ONCE(
         t_reinit_element_mappings =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::reinitElementMappings()");
+        t_repartition_mesh = TimerManager::getManager()->getTimer("IBTK::FEDataManager::repartitionMesh()");
         t_build_ghosted_solution_vector =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedSolutionVector()");
+        t_localize_ghosted_vectors =
+            TimerManager::getManager()->getTimer("IBTK::FEDataManager::localizeGhostedVectors()");
         t_spread = TimerManager::getManager()->getTimer("IBTK::FEDataManager::spread()");
         t_prolong_data = TimerManager::getManager()->getTimer("IBTK::FEDataManager::prolongData()");
         t_interp_weighted = TimerManager::getManager()->getTimer("IBTK::FEDataManager::interpWeighted()");
@@ -2121,13 +2839,13 @@ FEDataManager::~FEDataManager()
     {
         delete it->second;
     }
-    for (std::map<std::string, LinearSolver<double>*>::iterator it = d_L2_proj_solver.begin();
+    for (std::map<L2ProjectionSolverKey, LinearSolver<double>*>::iterator it = d_L2_proj_solver.begin();
          it != d_L2_proj_solver.end();
          ++it)
     {
         delete it->second;
     }
-    for (std::map<std::string, SparseMatrix<double>*>::iterator it = d_L2_proj_matrix.begin();
+    for (std::map<L2ProjectionSolverKey, SparseMatrix<double>*>::iterator it = d_L2_proj_matrix.begin();
          it != d_L2_proj_matrix.end();
          ++it)
     {
@@ -2236,12 +2954,11 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
     return;
 } // updateQuadPointCountData
 
-std::vector<std::pair<Point, Point> >*
-FEDataManager::computeActiveElementBoundingBoxes()
+void
+FEDataManager::computeActiveLocalElementBoundingBoxes()
 {
     // Get the necessary FE data.
-    const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int n_elem = mesh.max_elem_id() + 1;
+    MeshBase& mesh = d_es->get_mesh();
     System& X_system = d_es->get_system(COORDINATES_SYSTEM_NAME);
     const unsigned int X_sys_num = X_system.number();
     NumericVector<double>& X_vec = *X_system.solution;
@@ -2250,19 +2967,17 @@ FEDataManager::computeActiveElementBoundingBoxes()
 
     // Compute the lower and upper bounds of all active local elements in the
     // mesh.  Assumes nodal basis functions.
-    d_active_elem_bboxes.resize(n_elem);
-    std::fill(d_active_elem_bboxes.begin(), d_active_elem_bboxes.end(), std::make_pair(Point::Zero(), Point::Zero()));
+    d_active_local_elems.clear();
+    d_active_local_elem_bboxes.clear();
     std::vector<unsigned int> dof_indices;
-    MeshBase::const_element_iterator el_it = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    std::vector<double> X_node;
+    MeshBase::element_iterator el_it = mesh.active_local_elements_begin();
+    const MeshBase::element_iterator el_end = mesh.active_local_elements_end();
     for (; el_it != el_end; ++el_it)
     {
-        const Elem* const elem = *el_it;
-        const unsigned int elem_id = elem->id();
-        Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-        Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-        elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
-        elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
+        Elem* const elem = *el_it;
+        Point elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
+        Point elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
 
         const unsigned int n_nodes = elem->n_nodes();
         dof_indices.clear();
@@ -2275,7 +2990,6 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 dof_indices.push_back(node->dof_number(X_sys_num, d, 0));
             }
         }
-        std::vector<double> X_node;
         X_ghost_vec.get(dof_indices, X_node);
         for (unsigned int k = 0; k < n_nodes; ++k)
         {
@@ -2286,31 +3000,32 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 elem_upper_bound[d] = std::max(elem_upper_bound[d], X);
             }
         }
+        d_active_local_elems.push_back(elem);
+        d_active_local_elem_bboxes.push_back(std::make_pair(elem_lower_bound, elem_upper_bound));
     }
+    return;
+} // computeActiveLocalElementBoundingBoxes
 
-    // Parallel sum elem_lower_bound and elem_upper_bound so that each process
-    // has access to the bounding box data for each active element in the mesh.
-    std::vector<double> d_active_elem_bboxes_flattened(2 * NDIM * n_elem);
-    for (unsigned int e = 0; e < n_elem; ++e)
-    {
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            d_active_elem_bboxes_flattened[2 * e * NDIM + d] = d_active_elem_bboxes[e].first[d];
-            d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d] = d_active_elem_bboxes[e].second[d];
-        }
-    }
-    SAMRAI_MPI::sumReduction(&d_active_elem_bboxes_flattened[0],
-                             static_cast<int>(d_active_elem_bboxes_flattened.size()));
-    for (unsigned int e = 0; e < n_elem; ++e)
-    {
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            d_active_elem_bboxes[e].first[d] = d_active_elem_bboxes_flattened[2 * e * NDIM + d];
-            d_active_elem_bboxes[e].second[d] = d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d];
-        }
-    }
-    return &d_active_elem_bboxes;
-} // computeActiveElementBoundingBoxes
+void
+FEDataManager::closeGhostedVector(NumericVector<double>& ghost_vec)
+{
+    // A ghosted vector that has not been modified since it was last localized
+    // is already closed and its ghost values are current, so that it does not
+    // need to be closed again.
+    int ierr;
+    Vec vec = static_cast<PetscVector<double>*>(&ghost_vec)->vec();
+    PetscObjectId vec_id;
+    PetscObjectState vec_state;
+    ierr = PetscObjectGetId(reinterpret_cast<PetscObject>(vec), &vec_id);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(vec), &vec_state);
+    IBTK_CHKERRQ(ierr);
+    std::map<PetscObjectId, GhostVecLocalizationRecord>::const_iterator it =
+        d_ghost_vec_localization_records.find(vec_id);
+    if (it != d_ghost_vec_localization_records.end() && it->second.ghost_vec_state == vec_state) return;
+    ghost_vec.close();
+    return;
+} // closeGhostedVector
 
 void
 FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems,
@@ -2318,7 +3033,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
                                           const IntVector<NDIM>& ghost_width)
 {
     // Get the necessary FE data.
-    const MeshBase& mesh = d_es->get_mesh();
+    MeshBase& mesh = d_es->get_mesh();
     const Parallel::Communicator& comm = mesh.comm();
     const unsigned int dim = mesh.mesh_dimension();
     AutoPtr<QBase> qrule;
@@ -2345,49 +3060,100 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // element's bounding box intersects the patch interior grown by the
     // specified ghost cell width.
     //
-    // NOTE: Following the call to computeActiveElementBoundingBoxes, each
-    // processor will have access to all of the element bounding boxes.  This is
-    // not a scalable approach, but we won't worry about this until it becomes
-    // an actual issue.
-    computeActiveElementBoundingBoxes();
-    int local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    // NOTE: Each process computes the bounding boxes of only its own elements.
+    // Patches are binned on a coarse index space whose bins are as large as
+    // the largest patch, so that each element is tested against only a few
+    // candidate patches.  Elements are then sent only to the processes that
+    // own the patches that they intersect.
+    computeActiveLocalElementBoundingBoxes();
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const ProcessorMapping& level_mapping = level->getProcessorMapping();
+    const int num_patches = level->getNumberOfPatches();
+    std::vector<Box<NDIM> > grown_patch_boxes(num_patches);
+    for (int k = 0; k < num_patches; ++k)
     {
-        std::set<Elem*>& frontier_elems = frontier_patch_elems[local_patch_num];
-        Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        Point x_lower;
-        for (unsigned int d = 0; d < NDIM; ++d) x_lower[d] = pgeom->getXLower()[d];
-        Point x_upper;
-        for (unsigned int d = 0; d < NDIM; ++d) x_upper[d] = pgeom->getXUpper()[d];
-        const double* const dx = pgeom->getDx();
-        for (unsigned int d = 0; d < NDIM; ++d)
+        grown_patch_boxes[k] = Box<NDIM>::grow(level_boxes[k], ghost_width);
+    }
+    IntVector<NDIM> bin_size;
+    Box<NDIM> bin_domain;
+    std::vector<std::vector<int> > bin_patches;
+    bin_boxes(bin_patches, bin_domain, bin_size, grown_patch_boxes);
+
+    // Determine the patches (and their owning processes) that intersect the
+    // bounding box of each local element.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    std::vector<std::vector<int> > send_data(mpi_size);
+    std::vector<int> candidate_patches;
+    for (unsigned int e = 0; e < d_active_local_elems.size(); ++e)
+    {
+        const Elem* const elem = d_active_local_elems[e];
+        const std::pair<Point, Point>& elem_bbox = d_active_local_elem_bboxes[e];
+        const Box<NDIM> elem_box(IndexUtilities::getCellIndex(elem_bbox.first, grid_geom, ratio),
+                                 IndexUtilities::getCellIndex(elem_bbox.second, grid_geom, ratio));
+        const Box<NDIM> elem_bin_box = Box<NDIM>::coarsen(elem_box, bin_size) * bin_domain;
+        candidate_patches.clear();
+        for (Box<NDIM>::Iterator b(elem_bin_box); b; b++)
         {
-            x_lower[d] -= dx[d] * ghost_width[d];
-            x_upper[d] += dx[d] * ghost_width[d];
+            const std::vector<int>& patches = bin_patches[bin_domain.offset(b())];
+            candidate_patches.insert(candidate_patches.end(), patches.begin(), patches.end());
         }
-
-        MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
-        for (; el_it != el_end; ++el_it)
+        std::sort(candidate_patches.begin(), candidate_patches.end());
+        candidate_patches.erase(std::unique(candidate_patches.begin(), candidate_patches.end()),
+                                candidate_patches.end());
+        for (std::vector<int>::const_iterator cit = candidate_patches.begin(); cit != candidate_patches.end(); ++cit)
         {
-            Elem* const elem = *el_it;
-            const unsigned int elem_id = elem->id();
-            const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-            const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-            bool in_patch = true;
-            for (unsigned int d = 0; d < NDIM && in_patch; ++d)
-            {
-                in_patch = in_patch && ((elem_upper_bound[d] >= x_lower[d] && elem_upper_bound[d] <= x_upper[d]) ||
-                                        (elem_lower_bound[d] >= x_lower[d] && elem_lower_bound[d] <= x_upper[d]));
-            }
-            if (in_patch)
-            {
-                frontier_elems.insert(elem);
-            }
+            const int k = *cit;
+            if (!grown_patch_boxes[k].intersects(elem_box)) continue;
+            std::vector<int>& data = send_data[level_mapping.getProcessorAssignment(k)];
+            data.push_back(k);
+            data.push_back(static_cast<int>(elem->id()));
         }
     }
 
+    // Exchange the (patch number, element id) pairs.
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    std::vector<int> send_counts(mpi_size), send_displs(mpi_size, 0);
+    std::vector<int> recv_counts(mpi_size), recv_displs(mpi_size, 0);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        send_counts[rank] = static_cast<int>(send_data[rank].size());
+    }
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, communicator);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    }
+    std::vector<int> send_buf(std::max(send_displs[mpi_size - 1] + send_counts[mpi_size - 1], 1));
+    std::vector<int> recv_buf(std::max(recv_displs[mpi_size - 1] + recv_counts[mpi_size - 1], 1));
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        std::copy(send_data[rank].begin(), send_data[rank].end(), send_buf.begin() + send_displs[rank]);
+    }
+    MPI_Alltoallv(&send_buf[0],
+                  &send_counts[0],
+                  &send_displs[0],
+                  MPI_INT,
+                  &recv_buf[0],
+                  &recv_counts[0],
+                  &recv_displs[0],
+                  MPI_INT,
+                  communicator);
+
+    // Assign the received elements to the local patches.
+    std::map<int, int> patch_num_to_local_patch_num;
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        patch_num_to_local_patch_num[p()] = local_patch_num;
+    }
+    const int recv_size = recv_displs[mpi_size - 1] + recv_counts[mpi_size - 1];
+    for (int k = 0; k < recv_size; k += 2)
+    {
+        const int patch_idx = patch_num_to_local_patch_num[recv_buf[k]];
+        frontier_patch_elems[patch_idx].insert(mesh.elem(recv_buf[k + 1]));
+    }
+
     // Recursively add/remove elements from the active sets that were generated
     // via the bounding box method.
     bool done = false;
@@ -45,6 +45,7 @@
 #include "petscvec.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -53,6 +54,9 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+unsigned int LData::s_num_ghost_updates_performed = 0;
+unsigned int LData::s_num_ghost_updates_skipped = 0;
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LData::LData(const std::string& name,
@@ -75,7 +79,11 @@ LData::LData(const std::string& name,
       d_ghosted_local_vec(NULL),
       d_ghosted_local_array(NULL),
       d_boost_ghosted_local_array(NULL),
-      d_boost_vec_ghosted_local_array(NULL)
+      d_boost_vec_ghosted_local_array(NULL),
+      d_data_state(0),
+      d_data_version(1),
+      d_ghost_data_version(0),
+      d_ghost_update_in_progress(false)
 {
     // Create the PETSc Vec that provides storage for the Lagrangian data.
     int ierr;
@@ -133,7 +141,11 @@ LData::LData(const std::string& name,
       d_ghosted_local_vec(NULL),
       d_ghosted_local_array(NULL),
       d_boost_ghosted_local_array(NULL),
-      d_boost_vec_ghosted_local_array(NULL)
+      d_boost_vec_ghosted_local_array(NULL),
+      d_data_state(0),
+      d_data_version(1),
+      d_ghost_data_version(0),
+      d_ghost_update_in_progress(false)
 {
     int ierr;
     int depth;
@@ -171,6 +183,7 @@ LData::LData(Pointer<Database> db)
       d_depth(db->getInteger("d_depth")),
       d_nonlocal_petsc_indices(),
       d_global_vec(NULL),
+      d_managing_petsc_vec(true),
       d_array(NULL),
       d_boost_array(NULL),
       d_boost_local_array(NULL),
@@ -179,7 +192,11 @@ LData::LData(Pointer<Database> db)
       d_ghosted_local_vec(NULL),
       d_ghosted_local_array(NULL),
       d_boost_ghosted_local_array(NULL),
-      d_boost_vec_ghosted_local_array(NULL)
+      d_boost_vec_ghosted_local_array(NULL),
+      d_data_state(0),
+      d_data_version(1),
+      d_ghost_data_version(0),
+      d_ghost_update_in_progress(false)
 {
     int num_local_nodes = db->getInteger("num_local_nodes");
     int num_ghost_nodes = db->getInteger("num_ghost_nodes");
@@ -238,6 +255,7 @@ LData::LData(Pointer<Database> db)
 
 LData::~LData()
 {
+    endGhostUpdate();
     restoreArrays();
     if (d_managing_petsc_vec)
     {
@@ -250,6 +268,7 @@ LData::~LData()
 void
 LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const bool manage_petsc_vec)
 {
+    endGhostUpdate();
     restoreArrays();
     int ierr;
     if (d_managing_petsc_vec)
@@ -287,9 +306,75 @@ LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const
     d_local_node_count /= d_depth;
     d_nonlocal_petsc_indices = nonlocal_petsc_indices;
     d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
+    ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(d_global_vec), &d_data_state);
+    IBTK_CHKERRQ(ierr);
+    ++d_data_version;
     return;
 } // resetData
 
+void
+LData::beginGhostUpdate()
+{
+    // Complete any outstanding ghost update before deciding whether a new one
+    // is required.
+    endGhostUpdate();
+
+    // NOTE: Ghost updates are implemented via point-to-point communication, so
+    // the update can be skipped only if the ghost values are current on all
+    // processes.  Whether the data have been modified is tracked separately on
+    // each process (e.g., a process may modify only its own local values), so
+    // the decision requires a global reduction.
+    if (SAMRAI_MPI::minReduction(isGhostDataCurrent() ? 1 : 0) == 1)
+    {
+        ++s_num_ghost_updates_skipped;
+        return;
+    }
+    const int ierr = VecGhostUpdateBegin(d_global_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    d_ghost_update_in_progress = true;
+    ++s_num_ghost_updates_performed;
+    return;
+} // beginGhostUpdate
+
+void
+LData::endGhostUpdate()
+{
+    restoreArrays();
+    if (!d_ghost_update_in_progress) return;
+    int ierr = VecGhostUpdateEnd(d_global_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    d_ghost_update_in_progress = false;
+
+    // Synchronize the states of the global and ghosted local forms of the Vec.
+    // Updating the ghost values does not modify the local values, so the
+    // resulting state is recorded without changing the data version.
+    Vec ghosted_local_vec;
+    ierr = VecGhostGetLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(d_global_vec), &d_data_state);
+    IBTK_CHKERRQ(ierr);
+    d_ghost_data_version = d_data_version;
+    return;
+} // endGhostUpdate
+
+void
+LData::getGhostUpdateCounts(unsigned int& num_performed, unsigned int& num_skipped)
+{
+    num_performed = s_num_ghost_updates_performed;
+    num_skipped = s_num_ghost_updates_skipped;
+    return;
+} // getGhostUpdateCounts
+
+void
+LData::resetGhostUpdateCounts()
+{
+    s_num_ghost_updates_performed = 0;
+    s_num_ghost_updates_skipped = 0;
+    return;
+} // resetGhostUpdateCounts
+
 void
 LData::putToDatabase(Pointer<Database> db)
 {
@@ -311,7 +396,7 @@ LData::putToDatabase(Pointer<Database> db)
     {
         db->putDoubleArray("vals", ghosted_local_vec_array, d_depth * (num_local_nodes + num_ghost_nodes));
     }
-    restoreArrays();
+    restoreArrays(/*data_modified*/ false);
     return;
 } // putToDatabase
 
@@ -155,6 +155,7 @@ static Timer* t_begin_data_redistribution;
 static Timer* t_end_data_redistribution;
 static Timer* t_update_workload_estimates;
 static Timer* t_update_node_count_data;
+static Timer* t_update_lagrangian_structure_bounding_boxes;
 static Timer* t_initialize_level_data;
 static Timer* t_reset_hierarchy_configuration;
 static Timer* t_apply_gradient_detector;
@@ -286,10 +287,16 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_strct_id_to_lag_idx_range_map.resize(d_finest_ln + 1);
     d_last_lag_idx_to_strct_id_map.resize(d_finest_ln + 1);
     d_inactive_strcts.resize(d_finest_ln + 1);
+    d_inactive_lag_idx_ranges.resize(d_finest_ln + 1);
+    d_inactive_local_petsc_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_ids.resize(d_finest_ln + 1);
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_strct_bounding_boxes.resize(d_finest_ln + 1);
+    d_strct_centers_of_mass.resize(d_finest_ln + 1);
+    d_strct_bounding_boxes_valid.resize(d_finest_ln + 1, false);
+    d_strct_bounding_boxes_posn_version.resize(d_finest_ln + 1, 0);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
@@ -428,13 +435,11 @@ LDataManager::spread(const int f_data_idx,
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
 
-    // Zero inactivated components.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        zeroInactivatedComponents(F_data[ln], ln);
-    }
-
     // Compute F*ds.
+    //
+    // NOTE: Nodes of inactivated structures are excluded from the cached
+    // indexing data, and so they are never spread.  Their force values are
+    // still zeroed once any ghost update has completed.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!levelContainsLagrangianData(ln)) continue;
@@ -449,6 +454,7 @@ LDataManager::spread(const int f_data_idx,
 
         if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
         if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
+        zeroInactivatedLocalComponents(F_data[ln], ln);
 
         const int depth = F_data[ln]->getDepth();
         F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
@@ -463,8 +469,8 @@ LDataManager::spread(const int f_data_idx,
             }
         }
         F_ds_data[ln]->restoreArrays();
-        F_data[ln]->restoreArrays();
-        ds_data[ln]->restoreArrays();
+        F_data[ln]->restoreArrays(/*data_modified*/ false);
+        ds_data[ln]->restoreArrays(/*data_modified*/ false);
     }
 
     IBTK_TIMER_STOP(t_spread);
@@ -828,10 +834,13 @@ LDataManager::interp(const int f_data_idx,
         }
     }
 
-    // Zero inactivated components.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    // Nodes of inactivated structures are excluded from the cached indexing
+    // data, and so they are never interpolated to.  Zero the corresponding
+    // entries.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        zeroInactivatedComponents(F_data[ln], ln);
+        if (!levelContainsLagrangianData(ln)) continue;
+        zeroInactivatedLocalComponents(F_data[ln], ln);
     }
 
     IBTK_TIMER_STOP(t_interp);
@@ -928,75 +937,136 @@ LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, con
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
-    int node_counter = 0;
-    Point X_com(Point::Zero());
-    std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(structure_id, level_number);
+    if (!lagrangianStructureBoundingBoxesAreCurrent(level_number))
+    {
+        updateLagrangianStructureBoundingBoxes(level_number);
+    }
+    std::map<int, Point>::const_iterator cit = d_strct_centers_of_mass[level_number].find(structure_id);
+    if (cit == d_strct_centers_of_mass[level_number].end()) return Point::Zero();
+    return cit->second;
+} // computeLagrangianStructureCenterOfMass
 
-    const boost::multi_array_ref<double, 2>& X_data =
-        *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getLocalFormVecArray();
-    const Pointer<LMesh> mesh = getLMesh(level_number);
-    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+std::pair<Point, Point>
+LDataManager::computeLagrangianStructureBoundingBox(const int structure_id, const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    const std::map<int, std::pair<Point, Point> >& bounding_boxes = getLagrangianStructureBoundingBoxes(level_number);
+    std::map<int, std::pair<Point, Point> >::const_iterator cit = bounding_boxes.find(structure_id);
+    if (cit == bounding_boxes.end())
     {
-        const LNode* const node_idx = *cit;
-        const int lag_idx = node_idx->getLagrangianIndex();
-        if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-        {
-            ++node_counter;
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data[local_idx][0];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_com[d] += X[d];
-            }
-        }
+        return std::make_pair(Point(Point::Constant(std::numeric_limits<double>::max())),
+                              Point(Point::Constant(-std::numeric_limits<double>::max())));
     }
-    d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
+    return cit->second;
+} // computeLagrangianStructureBoundingBox
 
-    SAMRAI_MPI::sumReduction(&X_com[0], NDIM);
-    node_counter = SAMRAI_MPI::sumReduction(node_counter);
-    for (unsigned int d = 0; d < NDIM; ++d)
+const std::map<int, std::pair<Point, Point> >&
+LDataManager::getLagrangianStructureBoundingBoxes(const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    if (!lagrangianStructureBoundingBoxesAreCurrent(level_number))
     {
-        X_com[d] /= static_cast<double>(node_counter);
+        updateLagrangianStructureBoundingBoxes(level_number);
     }
-    return X_com;
-} // computeLagrangianStructureCenterOfMass
+    return d_strct_bounding_boxes[level_number];
+} // getLagrangianStructureBoundingBoxes
 
-std::pair<Point, Point>
-LDataManager::computeLagrangianStructureBoundingBox(const int structure_id, const int level_number)
+void
+LDataManager::updateLagrangianStructureBoundingBoxes(const int level_number)
 {
+    IBTK_TIMER_START(t_update_lagrangian_structure_bounding_boxes);
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
-    Point X_lower(Point::Constant(std::numeric_limits<double>::max()));
-    Point X_upper(Point::Constant(-std::numeric_limits<double>::max()));
-    std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(structure_id, level_number);
+    std::map<int, std::pair<Point, Point> >& bounding_boxes = d_strct_bounding_boxes[level_number];
+    std::map<int, Point>& centers_of_mass = d_strct_centers_of_mass[level_number];
+    bounding_boxes.clear();
+    centers_of_mass.clear();
+    if (!d_level_contains_lag_data[level_number])
+    {
+        d_strct_bounding_boxes_valid[level_number] = false;
+        IBTK_TIMER_STOP(t_update_lagrangian_structure_bounding_boxes);
+        return;
+    }
+
+    // Assign each structure a position in the arrays used to accumulate the
+    // bounding boxes and centers of mass.
+    const std::map<int, std::pair<int, int> >& lag_idx_range_map = d_strct_id_to_lag_idx_range_map[level_number];
+    const int num_strcts = static_cast<int>(lag_idx_range_map.size());
+    std::map<int, int> strct_id_to_offset_map;
+    for (std::map<int, std::pair<int, int> >::const_iterator cit = lag_idx_range_map.begin();
+         cit != lag_idx_range_map.end();
+         ++cit)
+    {
+        const int offset = static_cast<int>(strct_id_to_offset_map.size());
+        strct_id_to_offset_map[cit->first] = offset;
+    }
 
-    const boost::multi_array_ref<double, 2>& X_data =
-        *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getLocalFormVecArray();
+    // Accumulate the lower bounds, the negated upper bounds, and the sums of
+    // the positions of the local nodes of each structure.
+    //
+    // NOTE: The upper bounds are negated so that the bounding boxes of all of
+    // the structures can be computed with a single min reduction.
+    std::vector<double> X_bounds(2 * NDIM * num_strcts, std::numeric_limits<double>::max());
+    std::vector<double> X_sums((NDIM + 1) * num_strcts, 0.0);
+    Pointer<LData> X_data = d_lag_mesh_data[level_number][POSN_DATA_NAME];
+    const boost::multi_array_ref<double, 2>& X_arr = *X_data->getLocalFormVecArray();
     const Pointer<LMesh> mesh = getLMesh(level_number);
     const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
     for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
     {
         const LNode* const node_idx = *cit;
-        const int lag_idx = node_idx->getLagrangianIndex();
-        if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+        const int strct_id = getLagrangianStructureID(node_idx->getLagrangianIndex(), level_number);
+        if (strct_id == -1) continue;
+        const int offset = strct_id_to_offset_map[strct_id];
+        double* const X_lower = &X_bounds[2 * NDIM * offset];
+        double* const X_neg_upper = &X_bounds[2 * NDIM * offset + NDIM];
+        double* const X_sum = &X_sums[(NDIM + 1) * offset];
+        const double* const X = &X_arr[node_idx->getLocalPETScIndex()][0];
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data[local_idx][0];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_lower[d] = std::min(X_lower[d], X[d]);
-                X_upper[d] = std::max(X_upper[d], X[d]);
-            }
+            X_lower[d] = std::min(X_lower[d], X[d]);
+            X_neg_upper[d] = std::min(X_neg_upper[d], -X[d]);
+            X_sum[d] += X[d];
         }
+        X_sum[NDIM] += 1.0;
+    }
+    X_data->restoreArrays(/*data_modified*/ false);
+    if (num_strcts > 0)
+    {
+        SAMRAI_MPI::minReduction(&X_bounds[0], static_cast<int>(X_bounds.size()));
+        SAMRAI_MPI::sumReduction(&X_sums[0], static_cast<int>(X_sums.size()));
     }
-    d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
 
-    SAMRAI_MPI::minReduction(&X_lower[0], NDIM);
-    SAMRAI_MPI::maxReduction(&X_upper[0], NDIM);
-    return std::make_pair(X_lower, X_upper);
-} // computeLagrangianStructureBoundingBox
+    // Store the results.
+    for (std::map<int, int>::const_iterator cit = strct_id_to_offset_map.begin(); cit != strct_id_to_offset_map.end();
+         ++cit)
+    {
+        const int strct_id = cit->first;
+        const int offset = cit->second;
+        const double* const X_lower = &X_bounds[2 * NDIM * offset];
+        const double* const X_neg_upper = &X_bounds[2 * NDIM * offset + NDIM];
+        const double* const X_sum = &X_sums[(NDIM + 1) * offset];
+        std::pair<Point, Point>& bounding_box = bounding_boxes[strct_id];
+        Point& X_com = centers_of_mass[strct_id];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            bounding_box.first[d] = X_lower[d];
+            bounding_box.second[d] = -X_neg_upper[d];
+            X_com[d] = X_sum[d] / X_sum[NDIM];
+        }
+    }
+    d_strct_bounding_boxes_posn_version[level_number] = X_data->getDataVersion();
+    d_strct_bounding_boxes_valid[level_number] = true;
+
+    IBTK_TIMER_STOP(t_update_lagrangian_structure_bounding_boxes);
+    return;
+} // updateLagrangianStructureBoundingBoxes
 
 void
 LDataManager::reinitLagrangianStructure(const Point& X_center, const int structure_id, const int level_number)
@@ -1198,6 +1268,7 @@ LDataManager::activateLagrangianStructures(const std::vector<int>& structure_ids
         d_inactive_strcts[level_number].removeItem(*cit);
     }
     d_inactive_strcts[level_number].communicateData();
+    updateInactiveLagrangianIndexData(level_number, /*cache_patch_indices*/ true);
     return;
 } // activateLagrangianStructures
 
@@ -1212,6 +1283,7 @@ LDataManager::inactivateLagrangianStructures(const std::vector<int>& structure_i
         d_inactive_strcts[level_number].addItem(*cit);
     }
     d_inactive_strcts[level_number].communicateData();
+    updateInactiveLagrangianIndexData(level_number, /*cache_patch_indices*/ true);
     return;
 } // inactivateLagrangianStructures
 
@@ -1894,7 +1966,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_inactive_lag_idx_ranges[level_number]);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1924,6 +1996,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         std::ostringstream name_stream;
         name_stream << d_object_name << "::mesh::level_" << level_number;
         d_lag_mesh[level_number] = new LMesh(name_stream.str(), local_nodes, ghost_nodes);
+        updateInactiveLagrangianIndexData(level_number, /*cache_patch_indices*/ false);
     }
 
     // End scattering data, reset LData objects, and destroy the VecScatter
@@ -1948,17 +2021,22 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
-    }
 
-    // Distribute nonlocal data to the new configuration.
-    beginNonlocalDataFill(coarsest_ln, finest_ln);
-    endNonlocalDataFill(coarsest_ln, finest_ln);
+        // Start distributing nonlocal data on this level to the new
+        // configuration.
+        //
+        // NOTE: The fill is completed when the data are next accessed, which
+        // allows the communication to overlap with the redistribution of the
+        // remaining levels and with the remainder of the regridding process.
+        beginNonlocalDataFill(level_number, level_number);
+    }
 
     // Indicate that the levels have been synchronized and destroy unneeded
     // ordering and indexing objects.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         d_needs_synch[level_number] = false;
+        d_strct_bounding_boxes_valid[level_number] = false;
 
         if (d_ao[level_number])
         {
@@ -1991,6 +2069,58 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     return;
 } // endDataRedistribution
 
+void
+LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_begin_nonlocal_data_fill);
+
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
+        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
+        {
+            it->second->beginGhostUpdate();
+        }
+    }
+
+    IBTK_TIMER_STOP(t_begin_nonlocal_data_fill);
+    return;
+} // beginNonlocalDataFill
+
+void
+LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_end_nonlocal_data_fill);
+
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
+        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
+        {
+            it->second->endGhostUpdate();
+        }
+    }
+
+    IBTK_TIMER_STOP(t_end_nonlocal_data_fill);
+    return;
+} // endNonlocalDataFill
+
 void
 LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2154,10 +2284,16 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_strct_id_to_lag_idx_range_map.resize(level_number + 1);
         d_last_lag_idx_to_strct_id_map.resize(level_number + 1);
         d_inactive_strcts.resize(level_number + 1);
+        d_inactive_lag_idx_ranges.resize(level_number + 1);
+        d_inactive_local_petsc_idxs.resize(level_number + 1);
         d_displaced_strct_ids.resize(d_finest_ln + 1);
         d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+        d_strct_bounding_boxes.resize(level_number + 1);
+        d_strct_centers_of_mass.resize(level_number + 1);
+        d_strct_bounding_boxes_valid.resize(level_number + 1, false);
+        d_strct_bounding_boxes_posn_version.resize(level_number + 1, 0);
         d_lag_mesh.resize(level_number + 1);
         d_lag_mesh_data.resize(level_number + 1);
         d_needs_synch.resize(level_number + 1, false);
@@ -2214,6 +2350,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         createLData(POSN_DATA_NAME, level_number, NDIM, maintain_data);
         createLData(INIT_POSN_DATA_NAME, level_number, NDIM, maintain_data);
         createLData(VEL_DATA_NAME, level_number, NDIM, maintain_data);
+        d_strct_bounding_boxes_valid[level_number] = false;
 
         // 3. Initialize the Lagrangian data.
         d_lag_init->initializeStructureIndexingOnPatchLevel(d_strct_id_to_strct_name_map[level_number],
@@ -2288,7 +2425,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_inactive_lag_idx_ranges[level_number]);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2340,6 +2477,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_lag_mesh[level_number] = new LMesh(name_stream.str(),
                                              std::vector<LNode*>(local_nodes.begin(), local_nodes.end()),
                                              std::vector<LNode*>(ghost_nodes.begin(), ghost_nodes.end()));
+        updateInactiveLagrangianIndexData(level_number, /*cache_patch_indices*/ false);
 
         // 5. The AO (application order) is determined by the initial values of
         //    the local Lagrangian indices.
@@ -2769,6 +2907,8 @@ LDataManager::LDataManager(const std::string& object_name,
         t_update_workload_estimates =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::updateWorkloadEstimates()");
         t_update_node_count_data = TimerManager::getManager()->getTimer("IBTK::LDataManager::updateNodeCountData()");
+        t_update_lagrangian_structure_bounding_boxes =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::updateLagrangianStructureBoundingBoxes()");
         t_initialize_level_data = TimerManager::getManager()->getTimer("IBTK::LDataManager::initializeLevelData()");
         t_reset_hierarchy_configuration =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::resetHierarchyConfiguration()");
@@ -2872,58 +3012,6 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
     return;
 } // scatterData
 
-void
-LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
-{
-    IBTK_TIMER_START(t_begin_nonlocal_data_fill);
-
-    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
-    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
-
-#if !defined(NDEBUG)
-    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
-    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
-#endif
-
-    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
-    {
-        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
-        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
-        {
-            it->second->beginGhostUpdate();
-        }
-    }
-
-    IBTK_TIMER_STOP(t_begin_nonlocal_data_fill);
-    return;
-} // beginNonlocalDataFill
-
-void
-LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
-{
-    IBTK_TIMER_START(t_end_nonlocal_data_fill);
-
-    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
-    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
-
-#if !defined(NDEBUG)
-    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
-    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
-#endif
-
-    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
-    {
-        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
-        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
-        {
-            it->second->endGhostUpdate();
-        }
-    }
-
-    IBTK_TIMER_STOP(t_end_nonlocal_data_fill);
-    return;
-} // endNonlocalDataFill
-
 void
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
@@ -3141,6 +3229,87 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+bool
+LDataManager::lagrangianStructureBoundingBoxesAreCurrent(const int level_number)
+{
+    if (!d_strct_bounding_boxes_valid[level_number]) return false;
+    if (!d_level_contains_lag_data[level_number]) return true;
+    return d_strct_bounding_boxes_posn_version[level_number] ==
+           d_lag_mesh_data[level_number][POSN_DATA_NAME]->getDataVersion();
+} // lagrangianStructureBoundingBoxesAreCurrent
+
+void
+LDataManager::updateInactiveLagrangianIndexData(const int level_number, const bool cache_patch_indices)
+{
+    std::vector<std::pair<int, int> >& inactive_ranges = d_inactive_lag_idx_ranges[level_number];
+    std::vector<int>& inactive_idxs = d_inactive_local_petsc_idxs[level_number];
+    inactive_ranges.clear();
+    inactive_idxs.clear();
+    const std::set<int>& inactive_strcts = d_inactive_strcts[level_number].getSet();
+    for (std::set<int>::const_iterator cit = inactive_strcts.begin(); cit != inactive_strcts.end(); ++cit)
+    {
+        std::map<int, std::pair<int, int> >::const_iterator range_it =
+            d_strct_id_to_lag_idx_range_map[level_number].find(*cit);
+        if (range_it == d_strct_id_to_lag_idx_range_map[level_number].end()) continue;
+        inactive_ranges.push_back(range_it->second);
+    }
+    std::sort(inactive_ranges.begin(), inactive_ranges.end());
+
+    // The remaining data are only defined once the level has been distributed.
+    if (!d_hierarchy || level_number > d_hierarchy->getFinestLevelNumber() ||
+        !d_level_contains_lag_data[level_number] || !d_lag_mesh[level_number])
+        return;
+
+    if (cache_patch_indices)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            idx_data->cacheLocalIndices(patch, periodic_shift, inactive_ranges);
+        }
+    }
+
+    if (inactive_ranges.empty()) return;
+    const std::vector<LNode*>* const node_lists[2] = { &d_lag_mesh[level_number]->getLocalNodes(),
+                                                       &d_lag_mesh[level_number]->getGhostNodes() };
+    for (int k = 0; k < 2; ++k)
+    {
+        for (std::vector<LNode*>::const_iterator cit = node_lists[k]->begin(); cit != node_lists[k]->end(); ++cit)
+        {
+            const int lag_idx = (*cit)->getLagrangianIndex();
+            std::vector<std::pair<int, int> >::const_iterator it = std::upper_bound(
+                inactive_ranges.begin(), inactive_ranges.end(), std::make_pair(lag_idx, std::numeric_limits<int>::max()));
+            if (it == inactive_ranges.begin()) continue;
+            --it;
+            if (it->first <= lag_idx && lag_idx < it->second)
+            {
+                inactive_idxs.push_back((*cit)->getLocalPETScIndex());
+            }
+        }
+    }
+    std::sort(inactive_idxs.begin(), inactive_idxs.end());
+    return;
+} // updateInactiveLagrangianIndexData
+
+void
+LDataManager::zeroInactivatedLocalComponents(Pointer<LData> lag_data, const int level_number) const
+{
+    const std::vector<int>& inactive_idxs = d_inactive_local_petsc_idxs[level_number];
+    if (LIKELY(inactive_idxs.empty())) return;
+    double* const lag_arr = lag_data->getGhostedLocalFormVecArray()->data();
+    const unsigned int depth = lag_data->getDepth();
+    for (std::vector<int>::const_iterator cit = inactive_idxs.begin(); cit != inactive_idxs.end(); ++cit)
+    {
+        std::fill(lag_arr + depth * (*cit), lag_arr + depth * (*cit + 1), 0.0);
+    }
+    lag_data->restoreArrays();
+    return;
+} // zeroInactivatedLocalComponents
+
 void
 LDataManager::getFromRestart()
 {
@@ -3174,10 +3343,16 @@ LDataManager::getFromRestart()
     d_strct_id_to_lag_idx_range_map.resize(d_finest_ln + 1);
     d_last_lag_idx_to_strct_id_map.resize(d_finest_ln + 1);
     d_inactive_strcts.resize(d_finest_ln + 1);
+    d_inactive_lag_idx_ranges.resize(d_finest_ln + 1);
+    d_inactive_local_petsc_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_ids.resize(d_finest_ln + 1);
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_strct_bounding_boxes.resize(d_finest_ln + 1);
+    d_strct_centers_of_mass.resize(d_finest_ln + 1);
+    d_strct_bounding_boxes_valid.resize(d_finest_ln + 1, false);
+    d_strct_bounding_boxes_posn_version.resize(d_finest_ln + 1, 0);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
@@ -3229,6 +3404,7 @@ LDataManager::getFromRestart()
             }
         }
         d_inactive_strcts[level_number].communicateData();
+        updateInactiveLagrangianIndexData(level_number, /*cache_patch_indices*/ false);
 
         for (std::map<int, std::string>::const_iterator cit(d_strct_id_to_strct_name_map[level_number].begin());
              cit != d_strct_id_to_strct_name_map[level_number].end();
@@ -1059,7 +1059,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 periodic_shift,
                 interp_fcn);
     Q_data->restoreArrays();
-    X_data->restoreArrays();
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -1094,7 +1094,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 periodic_shift,
                 interp_fcn);
     Q_data->restoreArrays();
-    X_data->restoreArrays();
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -1135,7 +1135,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 periodic_shift,
                 interp_fcn);
     Q_data->restoreArrays();
-    X_data->restoreArrays();
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -1176,7 +1176,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 periodic_shift,
                 interp_fcn);
     Q_data->restoreArrays();
-    X_data->restoreArrays();
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -1932,8 +1932,8 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    Q_data->restoreArrays(/*data_modified*/ false);
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -1967,8 +1967,8 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    Q_data->restoreArrays(/*data_modified*/ false);
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -2008,8 +2008,8 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    Q_data->restoreArrays(/*data_modified*/ false);
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -2049,8 +2049,8 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    Q_data->restoreArrays(/*data_modified*/ false);
+    X_data->restoreArrays(/*data_modified*/ false);
     return;
 }
 
@@ -2476,6 +2476,38 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(patch);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    spread(q_data.getPointer(),
+           Q_data,
+           Q_size,
+           Q_depth,
+           X_data,
+           X_size,
+           X_depth,
+           pgeom.getPointer(),
+           patch->getBox(),
+           spread_box,
+           spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(CellData<NDIM, double>* const q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const CartesianPatchGeometry<NDIM>* const pgeom,
+                     const Box<NDIM>& patch_box,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(pgeom);
     TBOX_ASSERT(Q_depth == q_data->getDepth());
     TBOX_ASSERT(X_depth == NDIM);
     TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
@@ -2483,7 +2515,6 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     NULL_USE(Q_size);
 #endif
     // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
     const double* const x_upper = pgeom->getXUpper();
     const double* const dx = pgeom->getDx();
@@ -2500,7 +2531,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, pgeom, patch_box, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
     // Spread.
@@ -2598,7 +2629,7 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
 void
 LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const double* const Q_data,
-                     const int /*Q_size*/,
+                     const int Q_size,
                      const int Q_depth,
                      const double* const X_data,
                      const int X_size,
@@ -2606,6 +2637,38 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    spread(q_data.getPointer(),
+           Q_data,
+           Q_size,
+           Q_depth,
+           X_data,
+           X_size,
+           X_depth,
+           pgeom.getPointer(),
+           patch->getBox(),
+           spread_box,
+           spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(SideData<NDIM, double>* const q_data,
+                     const double* const Q_data,
+                     const int /*Q_size*/,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const CartesianPatchGeometry<NDIM>* const pgeom,
+                     const Box<NDIM>& patch_box,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
     if (Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -2614,12 +2677,11 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     }
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
-    TBOX_ASSERT(patch);
+    TBOX_ASSERT(pgeom);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
 #endif
     // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
     const double* const x_upper = pgeom->getXUpper();
     const double* const dx = pgeom->getDx();
@@ -2636,7 +2698,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, pgeom, patch_box, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
     // Spread.
@@ -3813,6 +3875,7 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
             for (typename LSet<T>::const_iterator n = idx_set.begin(); n != idx_set.end(); ++n)
             {
                 const typename LSet<T>::value_type& idx = *n;
+                if (!idx_data->isActiveLagrangianIndex(idx->getLagrangianIndex())) continue;
                 local_indices.push_back(idx->getLocalPETScIndex());
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
@@ -3848,6 +3911,33 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     return;
 }
 
+void
+LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
+                                const Box<NDIM>& box,
+                                const CartesianPatchGeometry<NDIM>* const patch_geom,
+                                const Box<NDIM>& patch_box,
+                                const double* const X_data,
+                                const int X_size,
+                                const int X_depth)
+{
+    local_indices.clear();
+    const int upper_bound = X_size / X_depth;
+    if (upper_bound == 0) return;
+
+    const double* const x_lower = patch_geom->getXLower();
+    const double* const x_upper = patch_geom->getXUpper();
+    const double* const dx = patch_geom->getDx();
+    local_indices.reserve(upper_bound);
+    for (int k = 0; k < X_size / X_depth; ++k)
+    {
+        const double* const X = &X_data[NDIM * k];
+        const Index<NDIM> i =
+            IndexUtilities::getCellIndex(X, x_lower, x_upper, dx, patch_box.lower(), patch_box.upper());
+        if (box.contains(i)) local_indices.push_back(k);
+    }
+    return;
+}
+
 void
 LEInteractor::userDefinedInterpolate(double* Q,
                                      const int Q_depth,
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <utility>
 #include <vector>
 
 #include "Box.h"
@@ -75,7 +76,8 @@ LIndexSetData<T>::LIndexSetData(const Box<NDIM>& box, const IntVector<NDIM>& gho
       d_ghost_local_petsc_indices(),
       d_periodic_shifts(),
       d_interior_periodic_shifts(),
-      d_ghost_periodic_shifts()
+      d_ghost_periodic_shifts(),
+      d_inactive_lag_idx_ranges()
 {
     // intentionally blank
     return;
@@ -92,6 +94,17 @@ template <class T>
 void
 LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
 {
+    cacheLocalIndices(patch, periodic_shift, std::vector<std::pair<int, int> >());
+    return;
+} // cacheLocalIndices
+
+template <class T>
+void
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges)
+{
+    d_inactive_lag_idx_ranges = inactive_lag_idx_ranges;
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
     d_ghost_lag_indices.clear();
@@ -144,6 +157,7 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         {
             const typename LSet<T>::value_type& idx = *n;
             const int lag_idx = idx->getLagrangianIndex();
+            if (!isActiveLagrangianIndex(lag_idx)) continue;
             const int global_petsc_idx = idx->getGlobalPETScIndex();
             const int local_petsc_idx = idx->getLocalPETScIndex();
             d_lag_indices.push_back(lag_idx);
@@ -1142,6 +1142,26 @@ HierarchyMathOps::div(const int dst_idx,
     return;
 } // div
 
+void
+HierarchyMathOps::synchCoarseFineBoundary(const int dst_idx, const Pointer<SideVariable<NDIM, double> > /*dst_var*/)
+{
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_os_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*dst_data);
+        }
+        xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
+        level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // synchCoarseFineBoundary
+
 void
 HierarchyMathOps::grad(const int dst_idx,
                        const Pointer<CellVariable<NDIM, double> > dst_var,
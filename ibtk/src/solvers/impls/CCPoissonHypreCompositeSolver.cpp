@@ -0,0 +1,1411 @@
+// Filename: CCPoissonHypreCompositeSolver.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
+#include "CoarseFineBoundary.h"
+#include "CoarsenAlgorithm.h"
+#include "CoarsenOperator.h"
+#include "CoarsenSchedule.h"
+#include "HYPRE_parcsr_ls.h"
+#include "HYPRE_sstruct_ls.h"
+#include "HYPRE_sstruct_mv.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "SideDataFactory.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "ibtk/CCPoissonHypreCompositeSolver.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/PoissonUtilities.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_solve_system_hypre;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+// Each patch level is a separate part with a single cell-centered variable.
+static const int VAR = 0;
+
+// Number of possible periodic images of a box.
+#if (NDIM == 2)
+static const int NUM_PERIODIC_OFFSETS = 9;
+#endif
+#if (NDIM == 3)
+static const int NUM_PERIODIC_OFFSETS = 27;
+#endif
+
+struct IndexComp : std::binary_function<Index<NDIM>, Index<NDIM>, bool>
+{
+    bool operator()(const Index<NDIM>& lhs, const Index<NDIM>& rhs) const
+    {
+        return (lhs(0) < rhs(0)
+#if (NDIM > 1)
+                ||
+                (lhs(0) == rhs(0) && lhs(1) < rhs(1))
+#if (NDIM > 2)
+                ||
+                (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
+#endif
+#endif
+                    );
+    } // operator()
+};
+
+struct CouplingComp
+{
+    template <class Coupling>
+    bool operator()(const Coupling& lhs, const Coupling& rhs) const
+    {
+        if (lhs.row_idx != rhs.row_idx) return IndexComp()(lhs.row_idx, rhs.row_idx);
+        if (lhs.col_ln != rhs.col_ln) return lhs.col_ln < rhs.col_ln;
+        return IndexComp()(lhs.col_idx, rhs.col_idx);
+    } // operator()
+};
+
+template <class Coupling>
+inline bool
+same_column(const Coupling& lhs, const Coupling& rhs)
+{
+    return lhs.col_ln == rhs.col_ln && lhs.col_idx == rhs.col_idx;
+} // same_column
+
+// Tangential interpolation stencils used at coarse-fine interfaces, in order of
+// preference: centered quadratic, one-sided quadratic, one-sided linear, and
+// constant.
+static const int NUM_TANGENTIAL_STENCILS = 6;
+static const int TANGENTIAL_STENCIL_SZ[NUM_TANGENTIAL_STENCILS] = { 3, 3, 3, 2, 2, 1 };
+static const int TANGENTIAL_STENCIL_OFFSETS[NUM_TANGENTIAL_STENCILS][3] = {
+    { -1, 0, +1 }, { 0, +1, +2 }, { -2, -1, 0 }, { 0, +1, 0 }, { -1, 0, 0 }, { 0, 0, 0 }
+};
+#if (NDIM == 2)
+static const int NUM_TANGENTIAL_STENCIL_COMBINATIONS = NUM_TANGENTIAL_STENCILS;
+#endif
+#if (NDIM == 3)
+static const int NUM_TANGENTIAL_STENCIL_COMBINATIONS = NUM_TANGENTIAL_STENCILS * NUM_TANGENTIAL_STENCILS;
+#endif
+
+// Compute the weights of the Lagrange polynomial that interpolates values
+// given at the nodes x[0], ..., x[n-1] to the point x_eval.
+inline void
+compute_lagrange_weights(double* const wgts, const double* const x, const int n, const double x_eval)
+{
+    for (int k = 0; k < n; ++k)
+    {
+        wgts[k] = 1.0;
+        for (int m = 0; m < n; ++m)
+        {
+            if (m != k) wgts[k] *= (x_eval - x[m]) / (x[k] - x[m]);
+        }
+    }
+    return;
+} // compute_lagrange_weights
+
+// Determine the entry of the standard 2*NDIM+1 point stencil that corresponds to
+// the specified offset, or -1 if the offset is not part of the stencil.
+inline int
+get_stencil_index(const IntVector<NDIM>& offset)
+{
+    int axis = -1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (offset(d) == 0) continue;
+        if (axis != -1 || (offset(d) != -1 && offset(d) != +1)) return -1;
+        axis = d;
+    }
+    if (axis == -1) return 0;
+    return 1 + 2 * axis + (offset(axis) > 0 ? 1 : 0);
+} // get_stencil_index
+
+inline int
+coarsen_index(const int i, const int ratio)
+{
+    return (i < 0 ? (i + 1) / ratio - 1 : i / ratio);
+} // coarsen_index
+
+inline void
+set_boomeramg_options(HYPRE_Solver amg_solver,
+                      const int coarsen_type,
+                      const int relax_type,
+                      const int num_sweeps,
+                      const double strong_threshold)
+{
+    HYPRE_BoomerAMGSetPrintLevel(amg_solver, 0);
+    HYPRE_BoomerAMGSetCoarsenType(amg_solver, coarsen_type);
+    HYPRE_BoomerAMGSetRelaxType(amg_solver, relax_type);
+    HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
+    HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
+    return;
+} // set_boomeramg_options
+
+inline void
+zero_covered_cells(CellData<NDIM, double>& data, const BoxArray<NDIM>& covered_boxes)
+{
+    for (int k = 0; k < covered_boxes.getNumberOfBoxes(); ++k)
+    {
+        const Box<NDIM> covered_box = data.getGhostBox() * covered_boxes[k];
+        if (!covered_box.empty()) data.fillAll(0.0, covered_box);
+    }
+    return;
+} // zero_covered_cells
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CCPoissonHypreCompositeSolver::CCPoissonHypreCompositeSolver(const std::string& object_name,
+                                                             Pointer<Database> input_db,
+                                                             const std::string& /*default_options_prefix*/)
+    : d_hierarchy(),
+      d_coarsest_ln(-1),
+      d_finest_ln(-1),
+      d_cf_boundary(),
+      d_covered_boxes(),
+      d_coarsen_op(),
+      d_coarsen_alg(),
+      d_coarsen_scheds(),
+      d_depth(0),
+      d_grid(NULL),
+      d_stencil(NULL),
+      d_graph(NULL),
+      d_matrices(),
+      d_rhs_vecs(),
+      d_sol_vecs(),
+      d_solvers(),
+      d_preconds(),
+      d_stencil_offsets(),
+      d_solver_type("BoomerAMG"),
+      d_precond_type("BoomerAMG"),
+      d_two_norm(1),
+      d_k_dim(30),
+      d_coarsen_type(10),
+      d_relax_type(6),
+      d_num_sweeps(1),
+      d_strong_threshold(NDIM == 3 ? 0.5 : 0.25)
+{
+    if (NDIM == 1 || NDIM > 3)
+    {
+        TBOX_ERROR(d_object_name << "::CCPoissonHypreCompositeSolver()"
+                                 << "  hypre solvers are only provided for 2D and 3D problems"
+                                 << std::endl);
+    }
+
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 25;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("solver_type")) d_solver_type = input_db->getString("solver_type");
+        if (input_db->keyExists("precond_type")) d_precond_type = input_db->getString("precond_type");
+        if (input_db->keyExists("max_iterations")) d_max_iterations = input_db->getInteger("max_iterations");
+        if (input_db->keyExists("abs_residual_tol")) d_abs_residual_tol = input_db->getDouble("abs_residual_tol");
+        if (input_db->keyExists("rel_residual_tol")) d_rel_residual_tol = input_db->getDouble("rel_residual_tol");
+        if (input_db->keyExists("initial_guess_nonzero"))
+            d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("two_norm")) d_two_norm = input_db->getInteger("two_norm");
+        if (input_db->keyExists("k_dim")) d_k_dim = input_db->getInteger("k_dim");
+        if (input_db->keyExists("coarsen_type")) d_coarsen_type = input_db->getInteger("coarsen_type");
+        if (input_db->keyExists("relax_type")) d_relax_type = input_db->getInteger("relax_type");
+        if (input_db->keyExists("num_sweeps")) d_num_sweeps = input_db->getInteger("num_sweeps");
+        if (input_db->keyExists("strong_threshold")) d_strong_threshold = input_db->getDouble("strong_threshold");
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreCompositeSolver::solveSystem()");
+                 t_solve_system_hypre =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreCompositeSolver::solveSystem()[hypre]");
+                 t_initialize_solver_state = TimerManager::getManager()->getTimer(
+                     "IBTK::CCPoissonHypreCompositeSolver::initializeSolverState()");
+                 t_deallocate_solver_state = TimerManager::getManager()->getTimer(
+                     "IBTK::CCPoissonHypreCompositeSolver::deallocateSolverState()"););
+    return;
+} // CCPoissonHypreCompositeSolver
+
+CCPoissonHypreCompositeSolver::~CCPoissonHypreCompositeSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~CCPoissonHypreCompositeSolver
+
+bool
+CCPoissonHypreCompositeSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Ensure the initial guess is zero when appropriate.
+    if (!d_initial_guess_nonzero) x.setToScalar(0.0, /*interior_only*/ false);
+
+    // Solve the system using the hypre solver.
+    static const int comp = 0;
+    const int x_idx = x.getComponentDescriptorIndex(comp);
+    const int b_idx = b.getComponentDescriptorIndex(comp);
+    const bool converged = solveSystem(x_idx, b_idx);
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+CCPoissonHypreCompositeSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                     const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components"
+                                 << std::endl);
+    }
+
+    const Pointer<PatchHierarchy<NDIM> >& patch_hierarchy = x.getPatchHierarchy();
+    if (patch_hierarchy != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy"
+                                 << std::endl);
+    }
+
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    if (coarsest_ln < 0)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest level number must not be negative"
+                                 << std::endl);
+    }
+    if (coarsest_ln != b.getCoarsestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same coarsest level number"
+                                 << std::endl);
+    }
+
+    const int finest_ln = x.getFinestLevelNumber();
+    if (finest_ln < coarsest_ln)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  finest level number must be >= coarsest level number"
+                                 << std::endl);
+    }
+    if (finest_ln != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same finest level number"
+                                 << std::endl);
+    }
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!patch_hierarchy->getPatchLevel(ln))
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  hierarchy level "
+                                     << ln
+                                     << " does not exist"
+                                     << std::endl);
+        }
+    }
+#else
+    NULL_USE(b);
+#endif
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_coarsest_ln = x.getCoarsestLevelNumber();
+    d_finest_ln = x.getFinestLevelNumber();
+    d_cf_boundary.resize(d_finest_ln + 1);
+    d_covered_boxes.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (ln > 0)
+        {
+            d_cf_boundary[ln] = new CoarseFineBoundary<NDIM>(*d_hierarchy, ln, IntVector<NDIM>(1));
+        }
+        if (ln < d_finest_ln)
+        {
+            Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+            d_covered_boxes[ln] = finer_level->getBoxes();
+            d_covered_boxes[ln].coarsen(finer_level->getRatioToCoarserLevel());
+        }
+    }
+
+    // Check the problem specification.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    d_depth = x_fac->getDefaultDepth();
+    if (!d_poisson_spec.dIsConstant())
+    {
+        Pointer<SideDataFactory<NDIM, double> > pdat_factory =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+        TBOX_ASSERT(pdat_factory);
+#endif
+        if (pdat_factory->getDefaultDepth() != 1)
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  only scalar diffusion coefficients are supported"
+                                     << std::endl);
+        }
+    }
+
+    // Setup the restriction operator used to synchronize the solution on
+    // covered cells.
+    Pointer<Variable<NDIM> > x_var;
+    var_db->mapIndexToVariable(x_idx, x_var);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    d_coarsen_op = grid_geometry->lookupCoarsenOperator(x_var, "CONSERVATIVE_COARSEN");
+    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
+    d_coarsen_alg->registerCoarsen(x_idx, x_idx, d_coarsen_op);
+    d_coarsen_scheds.resize(d_finest_ln);
+    for (int ln = d_coarsest_ln; ln < d_finest_ln; ++ln)
+    {
+        d_coarsen_scheds[ln] =
+            d_coarsen_alg->createSchedule(d_hierarchy->getPatchLevel(ln), d_hierarchy->getPatchLevel(ln + 1));
+    }
+
+    // Allocate and initialize the hypre data structures.
+    allocateHypreData();
+    setMatrixCoefficients();
+    setupHypreSolver();
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+CCPoissonHypreCompositeSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // Deallocate the hypre data structures.
+    destroyHypreSolver();
+    deallocateHypreData();
+
+    // Deallocate the hierarchy data.
+    d_cf_boundary.clear();
+    d_covered_boxes.clear();
+    d_coarsen_op.setNull();
+    d_coarsen_alg.setNull();
+    d_coarsen_scheds.clear();
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CCPoissonHypreCompositeSolver::getCoarseFineCouplings(std::vector<CoarseFineCoupling>& couplings,
+                                                      Pointer<Patch<NDIM> > patch,
+                                                      const int ln) const
+{
+    couplings.clear();
+    const Box<NDIM>& patch_box = patch->getBox();
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    std::vector<CoarseFineCoupling> nodes;
+
+    // The ghost value of each fine cell along the coarse-fine interface is
+    // replaced by its quadratic coarse-fine interpolant, which couples the fine
+    // cell to cells of the next coarser level.
+    if (ln > d_coarsest_ln)
+    {
+        const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+        const Array<BoundaryBox<NDIM> >& type_1_cf_bdry =
+            d_cf_boundary[ln]->getBoundaries(patch->getPatchNumber(), /* boundary type */ 1);
+        for (int n = 0; n < type_1_cf_bdry.size(); ++n)
+        {
+            const BoundaryBox<NDIM>& bdry_box = type_1_cf_bdry[n];
+            const unsigned int location_index = bdry_box.getLocationIndex();
+            const unsigned int axis = location_index / 2;
+            const int side = location_index % 2;
+            for (Box<NDIM>::Iterator b(bdry_box.getBox()); b; b++)
+            {
+                const Index<NDIM>& i_ghost = b();
+                Index<NDIM> i = i_ghost;
+                i(axis) += (side == 0 ? +1 : -1);
+                if (isCovered(i, ln)) continue;
+                Index<NDIM> i_coarse;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    i_coarse(d) = coarsen_index(i_ghost(d), ratio(d));
+                }
+                getCoarseFineInterpolationStencil(nodes, i, i_coarse, ln, axis, side);
+                for (std::vector<CoarseFineCoupling>::const_iterator it = nodes.begin(); it != nodes.end(); ++it)
+                {
+                    CoarseFineCoupling coupling = *it;
+                    coupling.row_idx = i;
+                    coupling.stencil_index = 1 + location_index;
+                    if (coupling.col_ln == ln)
+                    {
+                        coupling.col_stencil_index = get_stencil_index(coupling.col_idx - i);
+                    }
+                    else
+                    {
+                        coupling.col_idx = getPeriodicImage(coupling.col_idx, coupling.col_ln);
+                    }
+                    couplings.push_back(coupling);
+                }
+            }
+        }
+    }
+
+    // The flux through each coarse cell face along the coarse-fine interface is
+    // replaced by the average of the fluxes through the corresponding fine cell
+    // faces, which couples the coarse cell to cells of the next finer level.
+    if (ln < d_finest_ln)
+    {
+        Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+        const IntVector<NDIM>& ratio = finer_level->getRatioToCoarserLevel();
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level->getRatio());
+        const IntVector<NDIM>& fine_periodic_shift = grid_geometry->getPeriodicShift(finer_level->getRatio());
+        const BoxArray<NDIM>& covered_boxes = d_covered_boxes[ln];
+        const Box<NDIM> grown_patch_box = Box<NDIM>::grow(patch_box, 1);
+        for (int k = 0; k < covered_boxes.getNumberOfBoxes(); ++k)
+        {
+            for (int m = 0; m < NUM_PERIODIC_OFFSETS; ++m)
+            {
+                // Consider all periodic images of the covered box.
+                IntVector<NDIM> periodic_offset = 0;
+                bool valid_offset = true;
+                for (unsigned int d = 0, r = m; d < NDIM; ++d, r /= 3)
+                {
+                    periodic_offset(d) = static_cast<int>(r % 3) - 1;
+                    valid_offset = valid_offset && (periodic_offset(d) == 0 || periodic_shift(d) != 0);
+                }
+                if (!valid_offset) continue;
+                const Box<NDIM> covered_box = Box<NDIM>::shift(covered_boxes[k], periodic_offset * periodic_shift);
+                if ((grown_patch_box * covered_box).empty()) continue;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    // The ratio of the coarse and fine grid spacings normal to
+                    // the interface, divided by the number of fine cell faces
+                    // per coarse cell face.
+                    double flux_scale = static_cast<double>(ratio(axis));
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (d != axis) flux_scale /= static_cast<double>(ratio(d));
+                    }
+                    for (int box_side = 0; box_side <= 1; ++box_side)
+                    {
+                        Box<NDIM> adjacent_box = covered_box;
+                        const int i_adjacent =
+                            (box_side == 0 ? covered_box.lower()(axis) - 1 : covered_box.upper()(axis) + 1);
+                        adjacent_box.lower()(axis) = i_adjacent;
+                        adjacent_box.upper()(axis) = i_adjacent;
+                        adjacent_box = adjacent_box * patch_box;
+                        for (Box<NDIM>::Iterator b(adjacent_box); b; b++)
+                        {
+                            const Index<NDIM>& i_coarse = b();
+                            if (isCovered(i_coarse, ln)) continue;
+
+                            // Remove the coupling to the covered cell.
+                            CoarseFineCoupling coupling;
+                            coupling.row_idx = i_coarse;
+                            coupling.col_idx = i_coarse;
+                            coupling.col_ln = ln;
+                            coupling.stencil_index = 1 + 2 * axis + (1 - box_side);
+                            coupling.col_stencil_index = 0;
+                            coupling.wgt = 1.0;
+                            couplings.push_back(coupling);
+
+                            // Determine the fine cells that abut the coarse
+                            // cell face along the coarse-fine interface, and
+                            // add the fine cell fluxes, which are computed
+                            // using the same ghost values as the fine cell
+                            // equations.
+                            Box<NDIM> fine_box = Box<NDIM>::refine(Box<NDIM>(i_coarse, i_coarse), ratio);
+                            const int i_fine =
+                                (box_side == 0 ? fine_box.upper()(axis) + 1 : fine_box.lower()(axis) - 1);
+                            fine_box.lower()(axis) = i_fine;
+                            fine_box.upper()(axis) = i_fine;
+                            fine_box = Box<NDIM>::shift(fine_box, -(periodic_offset * fine_periodic_shift));
+                            for (Box<NDIM>::Iterator bf(fine_box); bf; bf++)
+                            {
+                                coupling.col_idx = bf();
+                                coupling.col_ln = ln + 1;
+                                coupling.col_stencil_index = -1;
+                                coupling.wgt = flux_scale;
+                                couplings.push_back(coupling);
+                                getCoarseFineInterpolationStencil(nodes, bf(), i_coarse, ln + 1, axis, box_side);
+                                for (std::vector<CoarseFineCoupling>::const_iterator it = nodes.begin();
+                                     it != nodes.end();
+                                     ++it)
+                                {
+                                    coupling.col_idx = it->col_idx;
+                                    coupling.col_ln = it->col_ln;
+                                    coupling.col_stencil_index = -1;
+                                    coupling.wgt = -flux_scale * it->wgt;
+                                    if (coupling.col_ln == ln)
+                                    {
+                                        coupling.col_stencil_index = get_stencil_index(coupling.col_idx - i_coarse);
+                                        if (coupling.col_stencil_index < 0)
+                                        {
+                                            coupling.col_idx = getPeriodicImage(coupling.col_idx, ln);
+                                        }
+                                    }
+                                    couplings.push_back(coupling);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Group the couplings by cell and by column.
+    std::stable_sort(couplings.begin(), couplings.end(), CouplingComp());
+    return;
+} // getCoarseFineCouplings
+
+void
+CCPoissonHypreCompositeSolver::getCoarseFineInterpolationStencil(std::vector<CoarseFineCoupling>& nodes,
+                                                                 const Index<NDIM>& i_fine,
+                                                                 const Index<NDIM>& i_coarse,
+                                                                 const int fine_ln,
+                                                                 const unsigned int axis,
+                                                                 const int side) const
+{
+    nodes.clear();
+    const int coarse_ln = fine_ln - 1;
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(fine_ln)->getRatioToCoarserLevel();
+
+    // Select the tangential interpolation stencils, preferring higher-order
+    // and centered stencils.  Stencils that include coarse cells that are
+    // covered by the fine level or that lie outside of the coarse level are
+    // not used.
+    unsigned int tangential_axes[NDIM - 1];
+    for (unsigned int d = 0, t = 0; d < NDIM; ++d)
+    {
+        if (d != axis) tangential_axes[t++] = d;
+    }
+    int stencil_ids[NDIM - 1];
+    bool found_stencil = false;
+    for (int rank = 0; rank <= (NDIM - 1) * (NUM_TANGENTIAL_STENCILS - 1) && !found_stencil; ++rank)
+    {
+        for (int m = 0; m < NUM_TANGENTIAL_STENCIL_COMBINATIONS && !found_stencil; ++m)
+        {
+            int stencil_rank = 0;
+            int num_nodes = 1;
+            for (unsigned int t = 0, r = m; t < NDIM - 1; ++t, r /= NUM_TANGENTIAL_STENCILS)
+            {
+                stencil_ids[t] = r % NUM_TANGENTIAL_STENCILS;
+                stencil_rank += stencil_ids[t];
+                num_nodes *= TANGENTIAL_STENCIL_SZ[stencil_ids[t]];
+            }
+            if (stencil_rank != rank) continue;
+            found_stencil = true;
+            for (int n = 0; n < num_nodes && found_stencil; ++n)
+            {
+                Index<NDIM> i_node = i_coarse;
+                for (unsigned int t = 0, r = n; t < NDIM - 1; ++t)
+                {
+                    const int sz = TANGENTIAL_STENCIL_SZ[stencil_ids[t]];
+                    i_node(tangential_axes[t]) += TANGENTIAL_STENCIL_OFFSETS[stencil_ids[t]][r % sz];
+                    r /= sz;
+                }
+                found_stencil = isValidInterpolationNode(i_node, coarse_ln);
+            }
+        }
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(found_stencil);
+#endif
+
+    // Compute the tangential interpolation weights.  The coarse cell centers
+    // are located at integer positions relative to the center of the coarse
+    // cell that contains the ghost cell.
+    double tangential_wgts[NDIM - 1][3];
+    for (unsigned int t = 0; t < NDIM - 1; ++t)
+    {
+        const unsigned int d = tangential_axes[t];
+        const int sz = TANGENTIAL_STENCIL_SZ[stencil_ids[t]];
+        double x[3];
+        for (int k = 0; k < sz; ++k)
+        {
+            x[k] = static_cast<double>(TANGENTIAL_STENCIL_OFFSETS[stencil_ids[t]][k]);
+        }
+        const int j_fine = i_fine(d) - ratio(d) * coarsen_index(i_fine(d), ratio(d));
+        const double x_eval = (static_cast<double>(j_fine) + 0.5) / static_cast<double>(ratio(d)) - 0.5;
+        compute_lagrange_weights(tangential_wgts[t], x, sz, x_eval);
+    }
+
+    // Compute the normal interpolation weights.  Positions are measured in
+    // units of the fine grid spacing from the coarse-fine interface, in the
+    // direction of the ghost cell.  The second fine cell is not used when it is
+    // covered by a finer level.
+    Index<NDIM> i_fine_interior = i_fine;
+    i_fine_interior(axis) += (side == 0 ? +1 : -1);
+    const bool use_interior = !isCovered(i_fine_interior, fine_ln);
+    const double x_normal[3] = { 0.5 * static_cast<double>(ratio(axis)), -0.5, -1.5 };
+    double normal_wgts[3];
+    compute_lagrange_weights(normal_wgts, x_normal, use_interior ? 3 : 2, 0.5);
+
+    // Collect the interpolation nodes and weights.
+    CoarseFineCoupling node;
+    node.stencil_index = -1;
+    node.col_stencil_index = -1;
+    int num_nodes = 1;
+    for (unsigned int t = 0; t < NDIM - 1; ++t)
+    {
+        num_nodes *= TANGENTIAL_STENCIL_SZ[stencil_ids[t]];
+    }
+    for (int n = 0; n < num_nodes; ++n)
+    {
+        node.col_idx = i_coarse;
+        node.col_ln = coarse_ln;
+        node.wgt = normal_wgts[0];
+        for (unsigned int t = 0, r = n; t < NDIM - 1; ++t)
+        {
+            const int sz = TANGENTIAL_STENCIL_SZ[stencil_ids[t]];
+            node.col_idx(tangential_axes[t]) += TANGENTIAL_STENCIL_OFFSETS[stencil_ids[t]][r % sz];
+            node.wgt *= tangential_wgts[t][r % sz];
+            r /= sz;
+        }
+        nodes.push_back(node);
+    }
+    node.col_idx = i_fine;
+    node.col_ln = fine_ln;
+    node.wgt = normal_wgts[1];
+    nodes.push_back(node);
+    if (use_interior)
+    {
+        node.col_idx = i_fine_interior;
+        node.wgt = normal_wgts[2];
+        nodes.push_back(node);
+    }
+    return;
+} // getCoarseFineInterpolationStencil
+
+Index<NDIM>
+CCPoissonHypreCompositeSolver::getPeriodicImage(const Index<NDIM>& i, const int ln) const
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& level_ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level_ratio);
+    const BoxArray<NDIM>& physical_domain = grid_geometry->getPhysicalDomain();
+    Index<NDIM> i_periodic = i;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int shift = periodic_shift(d);
+        if (shift == 0) continue;
+        int domain_lower = physical_domain[0].lower()(d);
+        for (int k = 1; k < physical_domain.getNumberOfBoxes(); ++k)
+        {
+            domain_lower = std::min(domain_lower, physical_domain[k].lower()(d));
+        }
+        domain_lower *= level_ratio(d);
+        const int offset = (i(d) - domain_lower) % shift;
+        i_periodic(d) = domain_lower + (offset < 0 ? offset + shift : offset);
+    }
+    return i_periodic;
+} // getPeriodicImage
+
+bool
+CCPoissonHypreCompositeSolver::isValidInterpolationNode(const Index<NDIM>& i, const int ln) const
+{
+    const Index<NDIM> i_periodic = getPeriodicImage(i, ln);
+    if (isCovered(i_periodic, ln)) return false;
+    const BoxArray<NDIM>& level_boxes = d_hierarchy->getPatchLevel(ln)->getBoxes();
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+    {
+        if (level_boxes[k].contains(i_periodic)) return true;
+    }
+    return false;
+} // isValidInterpolationNode
+
+bool
+CCPoissonHypreCompositeSolver::isCovered(const Index<NDIM>& i, const int ln) const
+{
+    if (ln >= d_finest_ln) return false;
+    const BoxArray<NDIM>& covered_boxes = d_covered_boxes[ln];
+    for (int k = 0; k < covered_boxes.getNumberOfBoxes(); ++k)
+    {
+        if (covered_boxes[k].contains(i)) return true;
+    }
+    return false;
+} // isCovered
+
+void
+CCPoissonHypreCompositeSolver::allocateHypreData()
+{
+    // Get the MPI communicator.
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+
+    // Setup the hypre grid, with one part per patch level, and assemble the
+    // grid.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    const int nparts = d_finest_ln - d_coarsest_ln + 1;
+    HYPRE_SStructGridCreate(communicator, NDIM, nparts, &d_grid);
+    HYPRE_SStructVariable vartypes[1] = { HYPRE_SSTRUCT_VARIABLE_CELL };
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const int part = ln - d_coarsest_ln;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            Index<NDIM> lower = patch_box.lower();
+            Index<NDIM> upper = patch_box.upper();
+            HYPRE_SStructGridSetExtents(d_grid, part, lower, upper);
+        }
+
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level->getRatio());
+        int hypre_periodic_shift[3];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            hypre_periodic_shift[d] = periodic_shift(d);
+        }
+        for (int d = NDIM; d < 3; ++d)
+        {
+            hypre_periodic_shift[d] = 0;
+        }
+        HYPRE_SStructGridSetPeriodic(d_grid, part, hypre_periodic_shift);
+        HYPRE_SStructGridSetVariables(d_grid, part, 1, vartypes);
+    }
+    HYPRE_SStructGridAssemble(d_grid);
+
+    // Allocate stencil data and set stencil offsets.
+    static const int stencil_sz = 2 * NDIM + 1;
+    d_stencil_offsets.resize(stencil_sz);
+    std::fill(d_stencil_offsets.begin(), d_stencil_offsets.end(), Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            d_stencil_offsets[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+    HYPRE_SStructStencilCreate(NDIM, stencil_sz, &d_stencil);
+    for (int s = 0; s < stencil_sz; ++s)
+    {
+        HYPRE_SStructStencilSetEntry(d_stencil, s, d_stencil_offsets[s], VAR);
+    }
+
+    // Allocate the hypre graph, including the non-stencil entries that couple
+    // the parts along coarse-fine interfaces.
+    HYPRE_SStructGraphCreate(communicator, d_grid, &d_graph);
+    HYPRE_SStructGraphSetObjectType(d_graph, HYPRE_PARCSR);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        HYPRE_SStructGraphSetStencil(d_graph, ln - d_coarsest_ln, VAR, d_stencil);
+    }
+    std::vector<CoarseFineCoupling> couplings;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const int part = ln - d_coarsest_ln;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            getCoarseFineCouplings(couplings, level->getPatch(p()), ln);
+            const CoarseFineCoupling* prev_coupling = NULL;
+            for (std::vector<CoarseFineCoupling>::iterator it = couplings.begin(); it != couplings.end(); ++it)
+            {
+                if (it->col_stencil_index >= 0) continue;
+                if (!prev_coupling || prev_coupling->row_idx != it->row_idx || !same_column(*prev_coupling, *it))
+                {
+                    HYPRE_SStructGraphAddEntries(
+                        d_graph, part, it->row_idx, VAR, it->col_ln - d_coarsest_ln, it->col_idx, VAR);
+                }
+                prev_coupling = &(*it);
+            }
+        }
+    }
+    HYPRE_SStructGraphAssemble(d_graph);
+
+    // Allocate the hypre matrices.
+    d_matrices.resize(d_depth);
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        HYPRE_SStructMatrixCreate(communicator, d_graph, &d_matrices[k]);
+        HYPRE_SStructMatrixSetObjectType(d_matrices[k], HYPRE_PARCSR);
+        HYPRE_SStructMatrixInitialize(d_matrices[k]);
+    }
+
+    // Allocate the hypre vectors.
+    d_sol_vecs.resize(d_depth);
+    d_rhs_vecs.resize(d_depth);
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        HYPRE_SStructVectorCreate(communicator, d_grid, &d_sol_vecs[k]);
+        HYPRE_SStructVectorSetObjectType(d_sol_vecs[k], HYPRE_PARCSR);
+        HYPRE_SStructVectorInitialize(d_sol_vecs[k]);
+
+        HYPRE_SStructVectorCreate(communicator, d_grid, &d_rhs_vecs[k]);
+        HYPRE_SStructVectorSetObjectType(d_rhs_vecs[k], HYPRE_PARCSR);
+        HYPRE_SStructVectorInitialize(d_rhs_vecs[k]);
+    }
+    return;
+} // allocateHypreData
+
+void
+CCPoissonHypreCompositeSolver::setMatrixCoefficients()
+{
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    std::vector<int> stencil_indices(stencil_sz);
+    for (int i = 0; i < stencil_sz; ++i)
+    {
+        stencil_indices[i] = i;
+    }
+    std::vector<double> mat_vals(stencil_sz, 0.0);
+    std::vector<CoarseFineCoupling> couplings;
+    std::vector<double> coupling_vals;
+    std::vector<int> entry_indices;
+    std::vector<double> entry_vals;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const int part = ln - d_coarsest_ln;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double cell_vol = dx[0] * dx[1]
+#if (NDIM > 2)
+                                    * dx[2]
+#endif
+                ;
+            getCoarseFineCouplings(couplings, patch, ln);
+            coupling_vals.resize(couplings.size());
+            CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
+            CellData<NDIM, double> stencil_vals(patch_box, stencil_sz, IntVector<NDIM>(0));
+            CellData<NDIM, double> covered_cells(patch_box, 1, IntVector<NDIM>(0));
+            covered_cells.fillAll(1.0);
+            zero_covered_cells(covered_cells, d_covered_boxes[ln]);
+            for (unsigned int k = 0; k < d_depth; ++k)
+            {
+                PoissonUtilities::computeMatrixCoefficients(
+                    matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs[k], d_solution_time);
+                stencil_vals.copy(matrix_coefs);
+
+                // Replace the standard stencil couplings across coarse-fine
+                // interfaces.  Each coupling is a multiple of the standard
+                // stencil coefficient that it replaces.
+                for (unsigned int n = 0; n < couplings.size();)
+                {
+                    const Index<NDIM> i = couplings[n].row_idx;
+                    unsigned int n_end = n;
+                    for (; n_end < couplings.size() && couplings[n_end].row_idx == i; ++n_end)
+                    {
+                        matrix_coefs(i, couplings[n_end].stencil_index) = 0.0;
+                    }
+                    for (; n < n_end; ++n)
+                    {
+                        const CoarseFineCoupling& coupling = couplings[n];
+                        const double coef = stencil_vals(i, coupling.stencil_index) * coupling.wgt;
+                        if (coupling.col_stencil_index >= 0)
+                        {
+                            matrix_coefs(i, coupling.col_stencil_index) += coef;
+                            coupling_vals[n] = 0.0;
+                        }
+                        else
+                        {
+                            coupling_vals[n] = coef;
+                        }
+                    }
+                }
+
+                // Scale the equations by the cell volume and copy matrix
+                // entries to the hypre matrix structure.  Covered cells are
+                // decoupled from the composite-grid system.
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    Index<NDIM> i = b();
+                    if (covered_cells(i, 0) == 0.0)
+                    {
+                        std::fill(mat_vals.begin(), mat_vals.end(), 0.0);
+                        mat_vals[0] = 1.0;
+                    }
+                    else
+                    {
+                        for (int j = 0; j < stencil_sz; ++j)
+                        {
+                            mat_vals[j] = cell_vol * matrix_coefs(i, j);
+                        }
+                    }
+                    HYPRE_SStructMatrixSetValues(
+                        d_matrices[k], part, i, VAR, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                }
+                for (unsigned int n = 0; n < couplings.size();)
+                {
+                    Index<NDIM> i = couplings[n].row_idx;
+                    entry_indices.clear();
+                    entry_vals.clear();
+                    const CoarseFineCoupling* prev_coupling = NULL;
+                    for (; n < couplings.size() && couplings[n].row_idx == i; ++n)
+                    {
+                        const CoarseFineCoupling& coupling = couplings[n];
+                        if (coupling.col_stencil_index >= 0) continue;
+                        if (!prev_coupling || !same_column(*prev_coupling, coupling))
+                        {
+                            entry_indices.push_back(stencil_sz + static_cast<int>(entry_indices.size()));
+                            entry_vals.push_back(0.0);
+                        }
+                        entry_vals.back() += cell_vol * coupling_vals[n];
+                        prev_coupling = &coupling;
+                    }
+                    if (entry_indices.empty()) continue;
+                    HYPRE_SStructMatrixSetValues(d_matrices[k],
+                                                 part,
+                                                 i,
+                                                 VAR,
+                                                 static_cast<int>(entry_indices.size()),
+                                                 &entry_indices[0],
+                                                 &entry_vals[0]);
+                }
+            }
+        }
+    }
+
+    // Assemble the hypre matrices.
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        HYPRE_SStructMatrixAssemble(d_matrices[k]);
+    }
+    return;
+} // setMatrixCoefficients
+
+void
+CCPoissonHypreCompositeSolver::setupHypreSolver()
+{
+    // Get the MPI communicator.
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+
+    d_solvers.resize(d_depth);
+    d_preconds.resize(d_depth);
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        HYPRE_ParCSRMatrix par_matrix;
+        HYPRE_ParVector par_rhs_vec, par_sol_vec;
+        HYPRE_SStructMatrixGetObject(d_matrices[k], reinterpret_cast<void**>(&par_matrix));
+        HYPRE_SStructVectorGetObject(d_rhs_vecs[k], reinterpret_cast<void**>(&par_rhs_vec));
+        HYPRE_SStructVectorGetObject(d_sol_vecs[k], reinterpret_cast<void**>(&par_sol_vec));
+
+        if (d_solver_type == "BoomerAMG")
+        {
+            HYPRE_BoomerAMGCreate(&d_solvers[k]);
+            set_boomeramg_options(d_solvers[k], d_coarsen_type, d_relax_type, d_num_sweeps, d_strong_threshold);
+            HYPRE_BoomerAMGSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_BoomerAMGSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_BoomerAMGSetup(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            d_preconds[k] = NULL;
+            continue;
+        }
+
+        // When using a Krylov method, setup the preconditioner.
+        if (d_precond_type == "BoomerAMG")
+        {
+            HYPRE_BoomerAMGCreate(&d_preconds[k]);
+            set_boomeramg_options(d_preconds[k], d_coarsen_type, d_relax_type, d_num_sweeps, d_strong_threshold);
+            HYPRE_BoomerAMGSetMaxIter(d_preconds[k], 1);
+            HYPRE_BoomerAMGSetTol(d_preconds[k], 0.0);
+        }
+        else if (d_precond_type == "none")
+        {
+            d_preconds[k] = NULL;
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  unknown preconditioner type: "
+                                     << d_precond_type
+                                     << std::endl);
+        }
+
+        if (d_solver_type == "PCG")
+        {
+            HYPRE_ParCSRPCGCreate(communicator, &d_solvers[k]);
+            HYPRE_ParCSRPCGSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRPCGSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRPCGSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_ParCSRPCGSetTwoNorm(d_solvers[k], d_two_norm);
+            if (d_preconds[k])
+            {
+                HYPRE_ParCSRPCGSetPrecond(d_solvers[k], HYPRE_BoomerAMGSolve, HYPRE_BoomerAMGSetup, d_preconds[k]);
+            }
+            HYPRE_ParCSRPCGSetup(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+        }
+        else if (d_solver_type == "GMRES")
+        {
+            HYPRE_ParCSRGMRESCreate(communicator, &d_solvers[k]);
+            HYPRE_ParCSRGMRESSetKDim(d_solvers[k], d_k_dim);
+            HYPRE_ParCSRGMRESSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRGMRESSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            if (d_preconds[k])
+            {
+                HYPRE_ParCSRGMRESSetPrecond(d_solvers[k], HYPRE_BoomerAMGSolve, HYPRE_BoomerAMGSetup, d_preconds[k]);
+            }
+            HYPRE_ParCSRGMRESSetup(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+        }
+        else if (d_solver_type == "FlexGMRES")
+        {
+            HYPRE_ParCSRFlexGMRESCreate(communicator, &d_solvers[k]);
+            HYPRE_ParCSRFlexGMRESSetKDim(d_solvers[k], d_k_dim);
+            HYPRE_ParCSRFlexGMRESSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRFlexGMRESSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRFlexGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            if (d_preconds[k])
+            {
+                HYPRE_ParCSRFlexGMRESSetPrecond(
+                    d_solvers[k], HYPRE_BoomerAMGSolve, HYPRE_BoomerAMGSetup, d_preconds[k]);
+            }
+            HYPRE_ParCSRFlexGMRESSetup(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+        }
+        else if (d_solver_type == "BiCGSTAB")
+        {
+            HYPRE_ParCSRBiCGSTABCreate(communicator, &d_solvers[k]);
+            HYPRE_ParCSRBiCGSTABSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRBiCGSTABSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRBiCGSTABSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            if (d_preconds[k])
+            {
+                HYPRE_ParCSRBiCGSTABSetPrecond(
+                    d_solvers[k], HYPRE_BoomerAMGSolve, HYPRE_BoomerAMGSetup, d_preconds[k]);
+            }
+            HYPRE_ParCSRBiCGSTABSetup(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  unknown solver type: "
+                                     << d_solver_type
+                                     << std::endl);
+        }
+    }
+    return;
+} // setupHypreSolver
+
+bool
+CCPoissonHypreCompositeSolver::solveSystem(const int x_idx, const int b_idx)
+{
+    // Modify right-hand-side data to account for boundary conditions, scale
+    // the equations by the cell volume, and copy solution and right-hand-side
+    // data to hypre structures.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const int part = ln - d_coarsest_ln;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double cell_vol = dx[0] * dx[1]
+#if (NDIM > 2)
+                                    * dx[2]
+#endif
+                ;
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+            Pointer<CellData<NDIM, double> > b_data = patch->getPatchData(b_idx);
+            CellData<NDIM, double> b_adj_data(b_data->getBox(), b_data->getDepth(), b_data->getGhostCellWidth());
+            b_adj_data.copy(*b_data);
+            if (pgeom->intersectsPhysicalBoundary())
+            {
+                PoissonUtilities::adjustRHSAtPhysicalBoundary(
+                    b_adj_data, patch, d_poisson_spec, d_bc_coefs, d_solution_time, d_homogeneous_bc);
+            }
+            if (ln == d_coarsest_ln && ln > 0)
+            {
+                const Array<BoundaryBox<NDIM> >& type_1_cf_bdry =
+                    d_cf_boundary[ln]->getBoundaries(patch->getPatchNumber(), /* boundary type */ 1);
+                if (type_1_cf_bdry.size() > 0)
+                {
+                    PoissonUtilities::adjustRHSAtCoarseFineBoundary(
+                        b_adj_data, *x_data, patch, d_poisson_spec, type_1_cf_bdry);
+                }
+            }
+
+            Index<NDIM> lower = patch_box.lower();
+            Index<NDIM> upper = patch_box.upper();
+            CellData<NDIM, double> hypre_data(patch_box, 1, IntVector<NDIM>(0));
+            double* const hypre_data_ptr = hypre_data.getPointer();
+            for (unsigned int k = 0; k < d_depth; ++k)
+            {
+                hypre_data.copyDepth(0, b_adj_data, k);
+                for (int n = 0; n < patch_box.size(); ++n)
+                {
+                    hypre_data_ptr[n] *= cell_vol;
+                }
+                zero_covered_cells(hypre_data, d_covered_boxes[ln]);
+                HYPRE_SStructVectorSetBoxValues(d_rhs_vecs[k], part, lower, upper, VAR, hypre_data_ptr);
+
+                hypre_data.copyDepth(0, *x_data, k);
+                zero_covered_cells(hypre_data, d_covered_boxes[ln]);
+                HYPRE_SStructVectorSetBoxValues(d_sol_vecs[k], part, lower, upper, VAR, hypre_data_ptr);
+            }
+        }
+    }
+
+    IBTK_TIMER_START(t_solve_system_hypre);
+
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        // Assemble the hypre vectors.
+        HYPRE_SStructVectorAssemble(d_sol_vecs[k]);
+        HYPRE_SStructVectorAssemble(d_rhs_vecs[k]);
+
+        HYPRE_ParCSRMatrix par_matrix;
+        HYPRE_ParVector par_rhs_vec, par_sol_vec;
+        HYPRE_SStructMatrixGetObject(d_matrices[k], reinterpret_cast<void**>(&par_matrix));
+        HYPRE_SStructVectorGetObject(d_rhs_vecs[k], reinterpret_cast<void**>(&par_rhs_vec));
+        HYPRE_SStructVectorGetObject(d_sol_vecs[k], reinterpret_cast<void**>(&par_sol_vec));
+
+        // Solve the system.
+        if (d_solver_type == "BoomerAMG")
+        {
+            HYPRE_BoomerAMGSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_BoomerAMGSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_BoomerAMGSolve(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            HYPRE_BoomerAMGGetNumIterations(d_solvers[k], &d_current_iterations);
+            HYPRE_BoomerAMGGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
+        }
+        else if (d_solver_type == "PCG")
+        {
+            HYPRE_ParCSRPCGSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRPCGSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRPCGSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_ParCSRPCGSolve(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            HYPRE_ParCSRPCGGetNumIterations(d_solvers[k], &d_current_iterations);
+            HYPRE_ParCSRPCGGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
+        }
+        else if (d_solver_type == "GMRES")
+        {
+            HYPRE_ParCSRGMRESSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRGMRESSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_ParCSRGMRESSolve(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            HYPRE_ParCSRGMRESGetNumIterations(d_solvers[k], &d_current_iterations);
+            HYPRE_ParCSRGMRESGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
+        }
+        else if (d_solver_type == "FlexGMRES")
+        {
+            HYPRE_ParCSRFlexGMRESSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRFlexGMRESSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRFlexGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_ParCSRFlexGMRESSolve(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            HYPRE_ParCSRFlexGMRESGetNumIterations(d_solvers[k], &d_current_iterations);
+            HYPRE_ParCSRFlexGMRESGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
+        }
+        else if (d_solver_type == "BiCGSTAB")
+        {
+            HYPRE_ParCSRBiCGSTABSetMaxIter(d_solvers[k], d_max_iterations);
+            HYPRE_ParCSRBiCGSTABSetTol(d_solvers[k], d_rel_residual_tol);
+            HYPRE_ParCSRBiCGSTABSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_ParCSRBiCGSTABSolve(d_solvers[k], par_matrix, par_rhs_vec, par_sol_vec);
+            HYPRE_ParCSRBiCGSTABGetNumIterations(d_solvers[k], &d_current_iterations);
+            HYPRE_ParCSRBiCGSTABGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
+        }
+
+        // Gather the solution values.
+        HYPRE_SStructVectorGather(d_sol_vecs[k]);
+    }
+
+    IBTK_TIMER_STOP(t_solve_system_hypre);
+
+    // Pull the solution vector out of the hypre structures.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const int part = ln - d_coarsest_ln;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+            Index<NDIM> lower = patch_box.lower();
+            Index<NDIM> upper = patch_box.upper();
+            CellData<NDIM, double> hypre_data(patch_box, 1, IntVector<NDIM>(0));
+            for (unsigned int k = 0; k < d_depth; ++k)
+            {
+                HYPRE_SStructVectorGetBoxValues(d_sol_vecs[k], part, lower, upper, VAR, hypre_data.getPointer());
+                x_data->copyDepth(k, hypre_data, 0);
+            }
+        }
+    }
+
+    // Synchronize the solution on covered cells.
+    for (int ln = d_finest_ln - 1; ln >= d_coarsest_ln; --ln)
+    {
+        CoarsenAlgorithm<NDIM> coarsener;
+        coarsener.registerCoarsen(x_idx, x_idx, d_coarsen_op);
+        coarsener.resetSchedule(d_coarsen_scheds[ln]);
+        d_coarsen_scheds[ln]->coarsenData();
+        d_coarsen_alg->resetSchedule(d_coarsen_scheds[ln]);
+    }
+    return (d_current_residual_norm <= d_rel_residual_tol || d_current_residual_norm <= d_abs_residual_tol);
+} // solveSystem
+
+void
+CCPoissonHypreCompositeSolver::destroyHypreSolver()
+{
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        // Destroy the solver.
+        if (d_solver_type == "BoomerAMG")
+        {
+            HYPRE_BoomerAMGDestroy(d_solvers[k]);
+        }
+        else if (d_solver_type == "PCG")
+        {
+            HYPRE_ParCSRPCGDestroy(d_solvers[k]);
+        }
+        else if (d_solver_type == "GMRES")
+        {
+            HYPRE_ParCSRGMRESDestroy(d_solvers[k]);
+        }
+        else if (d_solver_type == "FlexGMRES")
+        {
+            HYPRE_ParCSRFlexGMRESDestroy(d_solvers[k]);
+        }
+        else if (d_solver_type == "BiCGSTAB")
+        {
+            HYPRE_ParCSRBiCGSTABDestroy(d_solvers[k]);
+        }
+
+        // When using a Krylov method, destroy the preconditioner.
+        if (d_preconds[k]) HYPRE_BoomerAMGDestroy(d_preconds[k]);
+
+        // Set the solver and preconditioner pointers to NULL.
+        d_solvers[k] = NULL;
+        d_preconds[k] = NULL;
+    }
+    return;
+} // destroyHypreSolver
+
+void
+CCPoissonHypreCompositeSolver::deallocateHypreData()
+{
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        if (d_matrices[k]) HYPRE_SStructMatrixDestroy(d_matrices[k]);
+        if (d_sol_vecs[k]) HYPRE_SStructVectorDestroy(d_sol_vecs[k]);
+        if (d_rhs_vecs[k]) HYPRE_SStructVectorDestroy(d_rhs_vecs[k]);
+        d_matrices[k] = NULL;
+        d_sol_vecs[k] = NULL;
+        d_rhs_vecs[k] = NULL;
+    }
+    if (d_graph) HYPRE_SStructGraphDestroy(d_graph);
+    if (d_stencil) HYPRE_SStructStencilDestroy(d_stencil);
+    if (d_grid) HYPRE_SStructGridDestroy(d_grid);
+    d_graph = NULL;
+    d_stencil = NULL;
+    d_grid = NULL;
+    return;
+} // deallocateHypreData
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -198,6 +198,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -206,8 +207,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -381,6 +383,21 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Estimate the spectrum of the Jacobi-preconditioned operator the first
+    // time that Chebyshev smoothing is used on this level.
+    if (smoother_type == CHEBYSHEV && d_chebyshev_eig_max[level_num] < 0.0)
+    {
+        d_chebyshev_eig_max[level_num] = estimateChebyshevEigenvalue(error, level_num);
+    }
+
+    // Use communication-avoiding smoothing when it is enabled for this level.
+    if (red_black_ordering && useDeepHaloSmoothing(level_num))
+    {
+        smoothErrorDeepHalo(error, residual, level_num, 2 * num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -483,6 +500,27 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 }
             }
 
+            // Perform a Chebyshev iteration for each data depth.
+            if (smoother_type == CHEBYSHEV)
+            {
+                Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                double d_coef, z_coef;
+                getChebyshevCoefficients(isweep, d_chebyshev_eig_max[level_num], d_coef, z_coef);
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                {
+                    chebyshevUpdateBox(error_data->getArrayData(),
+                                       scratch_data->getArrayData(),
+                                       residual_data->getArrayData(),
+                                       NULL,
+                                       patch_box,
+                                       depth,
+                                       dx,
+                                       d_coef,
+                                       z_coef);
+                }
+                continue;
+            }
+
             // Smooth the error for each data depth.
             //
             // NOTE: Since the boundary conditions are handled "implicitly" by
@@ -689,6 +727,15 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CellDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_smoother_gcw > 1)
+    {
+        Pointer<CellDataFactory<NDIM, double> > halo_sol_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_halo_sol_idx);
+        halo_sol_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        Pointer<CellDataFactory<NDIM, double> > halo_rhs_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_halo_rhs_idx);
+        halo_rhs_pdat_fac->setDefaultDepth(rhs_pdat_fac->getDefaultDepth());
+    }
 
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
@@ -784,6 +831,135 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+double
+CCPoissonPointRelaxationFACOperator::estimateChebyshevEigenvalue(const SAMRAIVectorReal<NDIM, double>& error,
+                                                                 const int level_num)
+{
+    // Fall back on the Gershgorin bound when no power iterations are requested.
+    static const double GERSHGORIN_EIG_BOUND = 2.0;
+    if (d_chebyshev_eig_estimate_iterations == 0) return GERSHGORIN_EIG_BOUND;
+
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    Pointer<SAMRAIVectorReal<NDIM, double> > x = getLevelSAMRAIVectorReal(error, level_num)->cloneVector("");
+    Pointer<SAMRAIVectorReal<NDIM, double> > y = x->cloneVector("");
+    x->allocateVectorData();
+    y->allocateVectorData();
+
+    // Apply power iterations to D^{-1} A, treating coarse-fine interface ghost
+    // cell values as homogeneous Dirichlet boundary values.
+    double eig_max = 0.0;
+    x->setRandomValues(1.0, 0.0);
+    for (int k = 0; k < d_chebyshev_eig_estimate_iterations; ++k)
+    {
+        const double x_norm = x->L2Norm();
+        if (x_norm == 0.0) break;
+        x->scale(1.0 / x_norm, x);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > x_data = x->getComponentPatchData(0, *patch);
+            for (BoxList<NDIM>::Iterator b(d_patch_bc_box_overlap[level_num][patch_counter]); b; b++)
+            {
+                x_data->getArrayData().fillAll(0.0, b());
+            }
+        }
+        xeqScheduleGhostFillNoCoarse(x->getComponentDescriptorIndex(0), level_num);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > x_data = x->getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > y_data = y->getComponentPatchData(0, *patch);
+            for (int depth = 0; depth < x_data->getDepth(); ++depth)
+            {
+                computeJacobiCorrectionBox(
+                    y_data->getArrayData(), x_data->getArrayData(), NULL, NULL, patch_box, depth, dx);
+            }
+        }
+        eig_max = y->L2Norm();
+        std::swap(x, y);
+    }
+
+    x->freeVectorComponents();
+    y->freeVectorComponents();
+    return eig_max > 0.0 ? eig_max : GERSHGORIN_EIG_BOUND;
+} // estimateChebyshevEigenvalue
+
+void
+CCPoissonPointRelaxationFACOperator::smoothErrorDeepHalo(SAMRAIVectorReal<NDIM, double>& error,
+                                                         const SAMRAIVectorReal<NDIM, double>& residual,
+                                                         const int level_num,
+                                                         const int num_passes)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+
+    // Copy the error and residual into the scratch data.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+        Pointer<CellData<NDIM, double> > F_data = patch->getPatchData(d_halo_rhs_idx);
+        U_data->getArrayData().copy(error_data->getArrayData(), patch_box, IntVector<NDIM>(0));
+        F_data->getArrayData().copy(residual_data->getArrayData(), patch_box, IntVector<NDIM>(0));
+    }
+
+    // Perform the relaxation passes.  Immediately after a ghost cell exchange,
+    // values are valid up to a distance of d_smoother_gcw cells from each
+    // patch, and each pass reduces the width of the valid region by one.
+    int pass = 0;
+    bool fill_rhs = true;
+    while (pass < num_passes)
+    {
+        xeqScheduleDeepHaloFill(level_num, fill_rhs);
+        fill_rhs = false;
+        const int num_block_passes = std::min(d_smoother_gcw, num_passes - pass);
+        for (int k = 0; k < num_block_passes; ++k, ++pass)
+        {
+            if (k > 0) setDeepHaloPhysicalBoundaryConditions(level_num);
+            const int red_or_black = pass % 2; // "red" = 0, "black" = 1
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Box<NDIM> update_box = Box<NDIM>::grow(patch_box, d_smoother_gcw - 1 - k);
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                Pointer<CellData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+                Pointer<CellData<NDIM, double> > F_data = patch->getPatchData(d_halo_rhs_idx);
+                ArrayData<NDIM, double>& U = U_data->getArrayData();
+                const ArrayData<NDIM, double>& F = F_data->getArrayData();
+                const BoxList<NDIM>& halo_boxes = d_patch_halo_boxes[level_num][patch_counter];
+                for (int depth = 0; depth < U_data->getDepth(); ++depth)
+                {
+                    redBlackSmoothBox(U, F, NULL, patch_box, depth, dx, red_or_black);
+                    for (BoxList<NDIM>::Iterator b(halo_boxes); b; b++)
+                    {
+                        redBlackSmoothBox(U, F, NULL, b() * update_box, depth, dx, red_or_black);
+                    }
+                }
+            }
+        }
+    }
+
+    // Copy the smoothed error out of the scratch data.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+        error_data->getArrayData().copy(U_data->getArrayData(), patch_box, IntVector<NDIM>(0));
+    }
+    return;
+} // smoothErrorDeepHalo
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
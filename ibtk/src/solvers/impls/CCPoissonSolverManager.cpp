@@ -39,6 +39,8 @@
 #include <utility>
 
 #include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonFFTLevelSolver.h"
+#include "ibtk/CCPoissonHypreCompositeSolver.h"
 #include "ibtk/CCPoissonHypreLevelSolver.h"
 #include "ibtk/CCPoissonPETScLevelSolver.h"
 #include "ibtk/CCPoissonBoxRelaxationFACOperator.h"
@@ -70,9 +72,11 @@ const std::string CCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER = "DEFAULT_
 const std::string CCPoissonSolverManager::BOX_RELAXATION_FAC_PRECONDITIONER = "BOX_RELAXATION_FAC_PRECONDITIONER";
 const std::string CCPoissonSolverManager::LEVEL_RELAXATION_FAC_PRECONDITIONER = "LEVEL_RELAXATION_FAC_PRECONDITIONER";
 const std::string CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER = "POINT_RELAXATION_FAC_PRECONDITIONER";
+const std::string CCPoissonSolverManager::HYPRE_COMPOSITE_SOLVER = "HYPRE_COMPOSITE_SOLVER";
 const std::string CCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string CCPoissonSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 
 CCPoissonSolverManager* CCPoissonSolverManager::s_solver_manager_instance = NULL;
 bool CCPoissonSolverManager::s_registered_callback = false;
@@ -180,9 +184,11 @@ CCPoissonSolverManager::CCPoissonSolverManager() : d_solver_maker_map()
                                   CCPoissonLevelRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(POINT_RELAXATION_FAC_PRECONDITIONER,
                                   CCPoissonPointRelaxationFACOperator::allocate_solver);
+    registerSolverFactoryFunction(HYPRE_COMPOSITE_SOLVER, CCPoissonHypreCompositeSolver::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, CCPoissonPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, CCPoissonFFTLevelSolver::allocate_solver);
     return;
 } // CCPoissonSolverManager
 
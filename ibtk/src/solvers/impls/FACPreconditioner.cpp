@@ -33,8 +33,10 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -43,11 +45,14 @@
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/GeneralSolver.h"
+#include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -56,6 +61,23 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Return a view of the specified vector that is restricted to a range of levels
+// of the patch hierarchy.
+Pointer<SAMRAIVectorReal<NDIM, double> >
+get_level_vector(SAMRAIVectorReal<NDIM, double>& vec, const int coarsest_ln, const int finest_ln)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > level_vec = new SAMRAIVectorReal<NDIM, double>(
+        vec.getName() + "::level", vec.getPatchHierarchy(), coarsest_ln, finest_ln);
+    for (int comp = 0; comp < vec.getNumberOfComponents(); ++comp)
+    {
+        level_vec->addComponent(vec.getComponentVariable(comp), vec.getComponentDescriptorIndex(comp));
+    }
+    return level_vec;
+} // get_level_vector
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FACPreconditioner::FACPreconditioner(const std::string& object_name,
@@ -70,7 +92,15 @@ FACPreconditioner::FACPreconditioner(const std::string& object_name,
       d_num_pre_sweeps(0),
       d_num_post_sweeps(2),
       d_f(),
-      d_r()
+      d_r(),
+      d_res(),
+      d_err(),
+      d_k_c(),
+      d_k_v(),
+      d_k_cycle_tol(0.25),
+      d_residual_history(),
+      d_level_time(),
+      d_num_cycles(0)
 {
     // Setup default options.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ true);
@@ -130,54 +160,46 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
     // Allocate scratch data.
     d_fac_strategy->allocateScratchData();
 
-    // Set the initial guess to equal zero.
-    u.setToScalar(0.0, /*interior_only*/ false);
-
-    // Apply a single FAC cycle.
-    if (d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0)
+    bool converged = true;
+    if (d_max_iterations == 1 && !d_initial_guess_nonzero)
     {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(!d_f);
-        TBOX_ASSERT(!d_r);
-#endif
-        // V-cycle MG without presmoothing keeps the residual equal to the
-        // initial right-hand-side vector f, so we can simply use that vector
-        // for the residual in the FAC algorithm.
-        FACVCycleNoPreSmoothing(u, f, d_finest_ln);
+        // Apply a single FAC cycle to a zero initial guess.
+        applyCycle(u, f);
     }
     else
     {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_f);
-        TBOX_ASSERT(d_r);
-#endif
-        d_f->allocateVectorData();
-        d_r->allocateVectorData();
-        d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
-        d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
-        switch (d_cycle_type)
+        // Repeatedly apply FAC cycles to the residual equation.
+        d_res->allocateVectorData();
+        d_err->allocateVectorData();
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_ptr(&u, false);
+        if (!d_initial_guess_nonzero) u.setToScalar(0.0, /*interior_only*/ false);
+        const double f_norm = f.L2Norm();
+        computeCompositeResidual(*d_res, u, f);
+        d_current_iterations = 0;
+        d_current_residual_norm = d_res->L2Norm();
+        d_residual_history.clear();
+        d_residual_history.push_back(d_current_residual_norm);
+        converged = d_current_residual_norm <= d_abs_residual_tol ||
+                    d_current_residual_norm <= d_rel_residual_tol * f_norm;
+        while (!converged && d_current_iterations < d_max_iterations)
         {
-        case F_CYCLE:
-            FCycle(u, *d_f, d_finest_ln);
-            break;
-        case FMG_CYCLE:
-            FMGCycle(u, *d_f, d_finest_ln, 1);
-            break;
-        case V_CYCLE:
-            muCycle(u, *d_f, d_finest_ln, 1);
-            break;
-        case W_CYCLE:
-            muCycle(u, *d_f, d_finest_ln, 2);
-            break;
-        default:
-            TBOX_ERROR(d_object_name << "::solveSystem():\n"
-                                     << "  unsupported FAC cycle type: "
-                                     << enum_to_string<MGCycleType>(d_cycle_type)
-                                     << "."
-                                     << std::endl);
+            applyCycle(*d_err, *d_res);
+            u.add(u_ptr, d_err);
+            computeCompositeResidual(*d_res, u, f);
+            ++d_current_iterations;
+            d_current_residual_norm = d_res->L2Norm();
+            d_residual_history.push_back(d_current_residual_norm);
+            converged = d_current_residual_norm <= d_abs_residual_tol ||
+                        d_current_residual_norm <= d_rel_residual_tol * f_norm;
+        }
+        d_res->deallocateVectorData();
+        d_err->deallocateVectorData();
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+                 << "iterations = " << d_current_iterations << "\n"
+                 << "residual norm = " << d_current_residual_norm << std::endl;
         }
-        d_f->deallocateVectorData();
-        d_r->deallocateVectorData();
     }
 
     // Deallocate scratch data.
@@ -185,7 +207,7 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
 
     // Deallocate the solver, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
-    return true;
+    return converged;
 } // solveSystem
 
 void
@@ -216,6 +238,17 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
         d_f = rhs.cloneVector("");
         d_r = rhs.cloneVector("");
     }
+    if (d_cycle_type == K_CYCLE)
+    {
+        d_k_c = solution.cloneVector("");
+        d_k_v = rhs.cloneVector("");
+    }
+
+    d_res = rhs.cloneVector("");
+    d_err = solution.cloneVector("");
+
+    // Setup per-level timing data.
+    if (static_cast<int>(d_level_time.size()) < d_finest_ln + 1) d_level_time.resize(d_finest_ln + 1, 0.0);
 
     // Indicate the operator is initialized.
     d_is_initialized = true;
@@ -240,6 +273,30 @@ FACPreconditioner::deallocateSolverState()
         d_r.setNull();
     }
 
+    if (d_k_c)
+    {
+        d_k_c->freeVectorComponents();
+        d_k_c.setNull();
+    }
+
+    if (d_k_v)
+    {
+        d_k_v->freeVectorComponents();
+        d_k_v.setNull();
+    }
+
+    if (d_res)
+    {
+        d_res->freeVectorComponents();
+        d_res.setNull();
+    }
+
+    if (d_err)
+    {
+        d_err->freeVectorComponents();
+        d_err.setNull();
+    }
+
     // Deallocate operator state.
     d_fac_strategy->deallocateOperatorState();
 
@@ -251,24 +308,17 @@ FACPreconditioner::deallocateSolverState()
 void
 FACPreconditioner::setInitialGuessNonzero(bool initial_guess_nonzero)
 {
-    if (initial_guess_nonzero)
-    {
-        TBOX_ERROR(d_object_name << "::setInitialGuessNonzero()\n"
-                                 << "  class IBTK::FACPreconditioner requires a zero initial guess"
-                                 << std::endl);
-    }
+    d_initial_guess_nonzero = initial_guess_nonzero;
     return;
 } // setInitialGuessNonzero
 
 void
 FACPreconditioner::setMaxIterations(int max_iterations)
 {
-    if (max_iterations != 1)
-    {
-        TBOX_ERROR(d_object_name << "::setMaxIterations()\n"
-                                 << "  class IBTK::FACPreconditioner only performs a single iteration"
-                                 << std::endl);
-    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(max_iterations >= 1);
+#endif
+    d_max_iterations = max_iterations;
     return;
 } // setMaxIterations
 
@@ -311,19 +361,186 @@ FACPreconditioner::getNumPostSmoothingSweeps() const
     return d_num_post_sweeps;
 } // getNumPostSmoothingSweeps
 
+void
+FACPreconditioner::setKCycleTolerance(double k_cycle_tol)
+{
+    d_k_cycle_tol = k_cycle_tol;
+    return;
+} // setKCycleTolerance
+
+double
+FACPreconditioner::getKCycleTolerance() const
+{
+    return d_k_cycle_tol;
+} // getKCycleTolerance
+
 Pointer<FACPreconditionerStrategy>
 FACPreconditioner::getFACPreconditionerStrategy() const
 {
     return d_fac_strategy;
 } // getFACPreconditionerStrategy
 
+const std::vector<double>&
+FACPreconditioner::getResidualHistory() const
+{
+    return d_residual_history;
+} // getResidualHistory
+
+void
+FACPreconditioner::printCycleStatistics(std::ostream& os) const
+{
+    const int num_levels = static_cast<int>(d_level_time.size());
+    std::vector<double> level_time(d_level_time);
+    if (num_levels > 0) SAMRAI_MPI::maxReduction(&level_time[0], num_levels);
+    double total_time = 0.0;
+    for (int ln = 0; ln < num_levels; ++ln) total_time += level_time[ln];
+    os << d_object_name << "::printCycleStatistics():\n"
+       << "  number of FAC cycles = " << d_num_cycles << "\n";
+    for (int ln = 0; ln < num_levels; ++ln)
+    {
+        os << "  level " << ln << ": time = " << level_time[ln] << " s";
+        if (total_time > 0.0) os << " (" << 100.0 * level_time[ln] / total_time << "%)";
+        os << "\n";
+    }
+    if (!d_residual_history.empty())
+    {
+        os << "  residual history of the most recent solve:\n";
+        for (unsigned int k = 0; k < d_residual_history.size(); ++k)
+        {
+            os << "    iteration " << k << ": residual norm = " << d_residual_history[k];
+            if (k > 0 && d_residual_history[k - 1] > 0.0)
+            {
+                os << " (reduction factor = " << d_residual_history[k] / d_residual_history[k - 1] << ")";
+            }
+            os << "\n";
+        }
+    }
+    os.flush();
+    return;
+} // printCycleStatistics
+
+void
+FACPreconditioner::resetCycleStatistics()
+{
+    std::fill(d_level_time.begin(), d_level_time.end(), 0.0);
+    d_residual_history.clear();
+    d_num_cycles = 0;
+    return;
+} // resetCycleStatistics
+
+void
+FACPreconditioner::logCycleStatistics(Pointer<GeneralSolver> solver, std::ostream& os)
+{
+    Pointer<FACPreconditioner> fac_solver = solver;
+    if (!fac_solver)
+    {
+        Pointer<KrylovLinearSolver> krylov_solver = solver;
+        if (krylov_solver) fac_solver = krylov_solver->getPreconditioner();
+    }
+    if (!fac_solver) return;
+    fac_solver->printCycleStatistics(os);
+    fac_solver->resetCycleStatistics();
+    return;
+} // logCycleStatistics
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+FACPreconditioner::applyCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f)
+{
+    // Set the initial guess to equal zero.
+    u.setToScalar(0.0, /*interior_only*/ false);
+
+    // Apply a single FAC cycle.
+    if (d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(!d_f);
+        TBOX_ASSERT(!d_r);
+#endif
+        // V-cycle MG without presmoothing keeps the residual equal to the
+        // initial right-hand-side vector f, so we can simply use that vector
+        // for the residual in the FAC algorithm.
+        FACVCycleNoPreSmoothing(u, f, d_finest_ln);
+    }
+    else
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_f);
+        TBOX_ASSERT(d_r);
+#endif
+        d_f->allocateVectorData();
+        d_r->allocateVectorData();
+        d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
+        d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
+        if (d_cycle_type == K_CYCLE)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(d_k_c);
+            TBOX_ASSERT(d_k_v);
+#endif
+            d_k_c->allocateVectorData();
+            d_k_v->allocateVectorData();
+        }
+        switch (d_cycle_type)
+        {
+        case F_CYCLE:
+            FCycle(u, *d_f, d_finest_ln);
+            break;
+        case FMG_CYCLE:
+            FMGCycle(u, *d_f, d_finest_ln, 1);
+            break;
+        case K_CYCLE:
+            KCycle(u, *d_f, d_finest_ln);
+            break;
+        case V_CYCLE:
+            muCycle(u, *d_f, d_finest_ln, 1);
+            break;
+        case W_CYCLE:
+            muCycle(u, *d_f, d_finest_ln, 2);
+            break;
+        default:
+            TBOX_ERROR(d_object_name << "::applyCycle():\n"
+                                     << "  unsupported FAC cycle type: "
+                                     << enum_to_string<MGCycleType>(d_cycle_type)
+                                     << "."
+                                     << std::endl);
+        }
+        d_f->deallocateVectorData();
+        d_r->deallocateVectorData();
+        if (d_cycle_type == K_CYCLE)
+        {
+            d_k_c->deallocateVectorData();
+            d_k_v->deallocateVectorData();
+        }
+    }
+
+    ++d_num_cycles;
+    return;
+} // applyCycle
+
+void
+FACPreconditioner::computeCompositeResidual(SAMRAIVectorReal<NDIM, double>& r,
+                                            const SAMRAIVectorReal<NDIM, double>& u,
+                                            const SAMRAIVectorReal<NDIM, double>& f)
+{
+    // Compute the residual level-by-level, using the same level ranges as the
+    // FAC cycles so that cached operator state can be reused.  Residual values
+    // on covered parts of coarser levels are replaced by restricted fine level
+    // values during each cycle.
+    for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
+    {
+        d_fac_strategy->computeResidual(r, u, f, std::max(ln - 1, d_coarsest_ln), ln);
+    }
+    return;
+} // computeCompositeResidual
+
 void
 FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>& u,
                                            SAMRAIVectorReal<NDIM, double>& f,
                                            int level_num)
 {
+    double level_start_time = MPI_Wtime();
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
@@ -335,7 +552,9 @@ FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>& u,
         d_fac_strategy->restrictResidual(f, f, level_num - 1);
 
         // Recursively call the FAC algorithm.
+        d_level_time[level_num] += MPI_Wtime() - level_start_time;
         FACVCycleNoPreSmoothing(u, f, level_num - 1);
+        level_start_time = MPI_Wtime();
 
         // Prolong the error from the next coarser level.  Because we did not
         // perform any presmoothing, we do not need to correct the solution on
@@ -348,12 +567,14 @@ FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>& u,
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
         }
     }
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
     return;
 } // FACVCycleNoPreSmoothing
 
 void
 FACPreconditioner::muCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f, int level_num, int mu)
 {
+    double level_start_time = MPI_Wtime();
     if (level_num == d_coarsest_ln)
     {
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
@@ -367,19 +588,23 @@ FACPreconditioner::muCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<N
         d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
         d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
         d_fac_strategy->setToZero(u, level_num - 1);
+        d_level_time[level_num] += MPI_Wtime() - level_start_time;
         for (int k = 0; k < mu; ++k) muCycle(u, f, level_num - 1, mu);
+        level_start_time = MPI_Wtime();
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
         if (d_num_post_sweeps > 0)
         {
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
         }
     }
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
     return;
 } // muCycle
 
 void
 FACPreconditioner::FCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f, int level_num)
 {
+    double level_start_time = MPI_Wtime();
     if (level_num == d_coarsest_ln)
     {
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
@@ -393,20 +618,24 @@ FACPreconditioner::FCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<ND
         d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
         d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
         d_fac_strategy->setToZero(u, level_num - 1);
+        d_level_time[level_num] += MPI_Wtime() - level_start_time;
         muCycle(u, f, level_num - 1, 2);
         muCycle(u, f, level_num - 1, 1);
+        level_start_time = MPI_Wtime();
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
         if (d_num_post_sweeps > 0)
         {
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
         }
     }
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
     return;
 } // FCycle
 
 void
 FACPreconditioner::FMGCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f, int level_num, int mu)
 {
+    double level_start_time = MPI_Wtime();
     if (level_num == d_coarsest_ln)
     {
         d_fac_strategy->setToZero(u, level_num);
@@ -414,13 +643,117 @@ FACPreconditioner::FMGCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<
     else
     {
         d_fac_strategy->restrictResidual(f, f, level_num - 1);
+        d_level_time[level_num] += MPI_Wtime() - level_start_time;
         FMGCycle(u, f, level_num - 1, mu);
+        level_start_time = MPI_Wtime();
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
     }
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
     muCycle(u, f, level_num, mu);
     return;
 } // FMGCycle
 
+void
+FACPreconditioner::KCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f, int level_num)
+{
+    double level_start_time = MPI_Wtime();
+    if (level_num == d_coarsest_ln)
+    {
+        d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        d_level_time[level_num] += MPI_Wtime() - level_start_time;
+        return;
+    }
+
+    // Pre-smooth and restrict the residual to the next coarser level.
+    if (d_num_pre_sweeps > 0)
+    {
+        d_fac_strategy->smoothError(u, f, level_num, d_num_pre_sweeps, true, false);
+    }
+    d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+    d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
+    d_fac_strategy->setToZero(u, level_num - 1);
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
+
+    // Compute the coarse grid correction.  On the coarsest level, the coarse
+    // solver is used directly.  Otherwise, we perform up to two flexible CG
+    // iterations on the coarse level, preconditioned by the recursive K-cycle.
+    //
+    // The correction computed by the recursive cycle is a composite-grid
+    // vector on all levels up to and including the coarse level, and the
+    // coarse level operator depends on the values of the next coarser level
+    // at coarse-fine interfaces.  The iterates are therefore formed from the
+    // entire composite-grid correction, so that A*(a*c1 + b*c2) = a*v1 + b*v2
+    // also holds on levels that do not cover the physical domain.  The inner
+    // products are taken over the coarse level.
+    const int coarse_ln = level_num - 1;
+    KCycle(u, f, coarse_ln);
+    if (coarse_ln > d_coarsest_ln)
+    {
+        level_start_time = MPI_Wtime();
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_comp = get_level_vector(u, d_coarsest_ln, coarse_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > c_comp = get_level_vector(*d_k_c, d_coarsest_ln, coarse_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_c = get_level_vector(u, coarse_ln, coarse_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > f_c = get_level_vector(f, coarse_ln, coarse_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > r_c = get_level_vector(*d_r, coarse_ln, coarse_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > v_c = get_level_vector(*d_k_v, coarse_ln, coarse_ln);
+
+        // First iteration: c1 = B*r, v1 = A*c1, and r~ = r - (alpha1/rho1)*v1.
+        d_fac_strategy->computeResidual(*d_r, u, f, coarse_ln - 1, coarse_ln);
+        v_c->subtract(f_c, r_c);
+        const double rho1 = u_c->dot(v_c);
+        const double alpha1 = u_c->dot(f_c);
+        if (rho1 != 0.0)
+        {
+            const double r_norm = f_c->L2Norm();
+            f_c->axpy(-alpha1 / rho1, v_c, f_c);
+            if (f_c->L2Norm() <= d_k_cycle_tol * r_norm)
+            {
+                u_comp->scale(alpha1 / rho1, u_comp);
+                d_level_time[coarse_ln] += MPI_Wtime() - level_start_time;
+            }
+            else
+            {
+                // Second iteration: c2 = B*r~, v2 = A*c2, and the correction
+                // is the A-orthogonalized combination of c1 and c2.
+                c_comp->copyVector(u_comp, /*interior_only*/ false);
+                d_fac_strategy->setToZero(u, coarse_ln);
+                d_level_time[coarse_ln] += MPI_Wtime() - level_start_time;
+                KCycle(u, f, coarse_ln);
+                level_start_time = MPI_Wtime();
+                d_fac_strategy->computeResidual(*d_r, u, f, coarse_ln - 1, coarse_ln);
+                r_c->subtract(f_c, r_c);
+                const double gamma = u_c->dot(v_c);
+                const double beta = u_c->dot(r_c);
+                const double alpha2 = u_c->dot(f_c);
+                const double rho2 = beta - gamma * gamma / rho1;
+                if (rho2 != 0.0)
+                {
+                    u_comp->linearSum(alpha2 / rho2, u_comp, alpha1 / rho1 - gamma * alpha2 / (rho1 * rho2), c_comp);
+                }
+                else
+                {
+                    u_comp->scale(alpha1 / rho1, c_comp);
+                }
+                d_level_time[coarse_ln] += MPI_Wtime() - level_start_time;
+            }
+        }
+        else
+        {
+            d_level_time[coarse_ln] += MPI_Wtime() - level_start_time;
+        }
+    }
+
+    // Prolong the correction and post-smooth.
+    level_start_time = MPI_Wtime();
+    d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
+    if (d_num_post_sweeps > 0)
+    {
+        d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+    }
+    d_level_time[level_num] += MPI_Wtime() - level_start_time;
+    return;
+} // KCycle
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -431,6 +764,11 @@ FACPreconditioner::getFromInput(tbox::Pointer<tbox::Database> db)
     if (db->keyExists("num_pre_sweeps")) setNumPreSmoothingSweeps(db->getInteger("num_pre_sweeps"));
     if (db->keyExists("num_post_sweeps")) setNumPostSmoothingSweeps(db->getInteger("num_post_sweeps"));
     if (db->keyExists("enable_logging")) setLoggingEnabled(db->getBool("enable_logging"));
+    if (db->keyExists("k_cycle_tol")) setKCycleTolerance(db->getDouble("k_cycle_tol"));
+    if (db->keyExists("max_iterations")) setMaxIterations(db->getInteger("max_iterations"));
+    if (db->keyExists("rel_residual_tol")) setRelativeTolerance(db->getDouble("rel_residual_tol"));
+    if (db->keyExists("abs_residual_tol")) setAbsoluteTolerance(db->getDouble("abs_residual_tol"));
+    if (db->keyExists("initial_guess_nonzero")) setInitialGuessNonzero(db->getBool("initial_guess_nonzero"));
     return;
 } // getFromInput
 
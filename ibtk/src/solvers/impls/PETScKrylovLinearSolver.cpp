@@ -105,7 +105,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL),
       d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false),
+      d_recycle_space()
 {
     // Setup default values.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
@@ -127,6 +128,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
         if (input_db->keyExists("ksp_type")) d_ksp_type = input_db->getString("ksp_type");
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("recycle_space_size"))
+            d_recycle_space.setMaxSize(input_db->getInteger("recycle_space_size"));
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
     }
 
@@ -151,7 +154,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL),
       d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false),
+      d_recycle_space()
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     if (d_petsc_ksp) resetWrappedKSP(d_petsc_ksp);
@@ -194,6 +198,13 @@ PETScKrylovLinearSolver::setOptionsPrefix(const std::string& options_prefix)
     return;
 } // setOptionsPrefix
 
+void
+PETScKrylovLinearSolver::setRecycleSpaceSize(const int recycle_space_size)
+{
+    d_recycle_space.setMaxSize(recycle_space_size);
+    return;
+} // setRecycleSpaceSize
+
 const KSP&
 PETScKrylovLinearSolver::getPETScKSP() const
 {
@@ -257,8 +268,19 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(true);
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
+    const bool use_recycle_space = d_recycle_space.getMaxSize() > 0;
+    Mat petsc_mat = NULL;
+    if (use_recycle_space)
+    {
+        ierr = KSPGetOperators(d_petsc_ksp, &petsc_mat, NULL);
+        IBTK_CHKERRQ(ierr);
+        d_recycle_space.formInitialGuess(petsc_mat, d_petsc_x, d_petsc_b, d_initial_guess_nonzero);
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+    if (use_recycle_space) d_recycle_space.update(petsc_mat, d_petsc_x);
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
 
@@ -275,6 +297,12 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     IBTK_CHKERRQ(ierr);
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
+    if (d_enable_logging && use_recycle_space)
+    {
+        plog << d_object_name << "::solveSystem(): recycle space size = " << d_recycle_space.getSize()
+             << ", initial residual norm = " << d_recycle_space.getInitialResidualNorm()
+             << ", projected initial residual norm = " << d_recycle_space.getProjectedResidualNorm() << "\n";
+    }
 
     // Dealocate scratch data.
     d_b->deallocateVectorData();
@@ -451,6 +479,10 @@ PETScKrylovLinearSolver::deallocateSolverState()
     // Deallocate the nullspace object.
     deallocateNullspaceData();
 
+    // Discard the recycled vectors, which may no longer be compatible with
+    // the solver vectors.
+    d_recycle_space.reset();
+
     // Destroy the KSP solver.
     if (d_managing_petsc_ksp)
     {
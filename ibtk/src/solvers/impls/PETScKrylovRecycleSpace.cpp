@@ -0,0 +1,315 @@
+// Filename: PETScKrylovRecycleSpace.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <deque>
+#include <limits>
+#include <math.h>
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/PETScKrylovRecycleSpace.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "petscmat.h"
+#include "petscsys.h"
+#include "petscvec.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_form_initial_guess;
+static Timer* t_update;
+
+// Corrections whose images are (nearly) contained in the span of the retained
+// images are not added to the space.
+static const double REL_ORTHOGONALIZATION_TOL = sqrt(std::numeric_limits<double>::epsilon());
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PETScKrylovRecycleSpace::PETScKrylovRecycleSpace()
+    : d_max_size(0),
+      d_sol_vecs(),
+      d_img_vecs(),
+      d_x0(NULL),
+      d_r(NULL),
+      d_initial_residual_norm(0.0),
+      d_projected_residual_norm(0.0)
+{
+    // Setup Timers.
+    IBTK_DO_ONCE(t_form_initial_guess =
+                     TimerManager::getManager()->getTimer("IBTK::PETScKrylovRecycleSpace::formInitialGuess()");
+                 t_update = TimerManager::getManager()->getTimer("IBTK::PETScKrylovRecycleSpace::update()"););
+    return;
+} // PETScKrylovRecycleSpace
+
+PETScKrylovRecycleSpace::~PETScKrylovRecycleSpace()
+{
+    reset();
+    return;
+} // ~PETScKrylovRecycleSpace
+
+void
+PETScKrylovRecycleSpace::setMaxSize(const int max_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(max_size >= 0);
+#endif
+    d_max_size = max_size;
+    truncate(d_max_size);
+    return;
+} // setMaxSize
+
+int
+PETScKrylovRecycleSpace::getMaxSize() const
+{
+    return d_max_size;
+} // getMaxSize
+
+int
+PETScKrylovRecycleSpace::getSize() const
+{
+    return static_cast<int>(d_sol_vecs.size());
+} // getSize
+
+void
+PETScKrylovRecycleSpace::formInitialGuess(Mat A, Vec x, Vec b, const bool initial_guess_nonzero)
+{
+    IBTK_TIMER_START(t_form_initial_guess);
+
+    int ierr;
+    if (!d_x0)
+    {
+        ierr = VecDuplicate(x, &d_x0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDuplicate(x, &d_r);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Compute the residual of the initial guess.
+    if (initial_guess_nonzero)
+    {
+        ierr = MatMult(A, x, d_r);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAYPX(d_r, -1.0, b);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        ierr = VecSet(x, 0.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCopy(b, d_r);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecNorm(d_r, NORM_2, &d_initial_residual_norm);
+    IBTK_CHKERRQ(ierr);
+
+    // Recompute the images of the retained corrections.  The operator may have
+    // changed since the corrections were added (e.g., because the time step
+    // size has changed), so that the stored images are stale.  Corrections
+    // whose new images are (nearly) linearly dependent are discarded.
+    std::deque<Vec> sol_vecs, img_vecs;
+    sol_vecs.swap(d_sol_vecs);
+    img_vecs.swap(d_img_vecs);
+    for (unsigned int k = 0; k < sol_vecs.size(); ++k)
+    {
+        ierr = MatMult(A, sol_vecs[k], img_vecs[k]);
+        IBTK_CHKERRQ(ierr);
+        appendOrthonormalized(sol_vecs[k], img_vecs[k]);
+    }
+
+    // Project the residual onto the retained images.  Because the images are
+    // orthonormal images of the retained corrections under the current
+    // operator, the updated residual is the true residual b - A x.
+    for (unsigned int k = 0; k < d_sol_vecs.size(); ++k)
+    {
+        PetscScalar c;
+        ierr = VecDot(d_r, d_img_vecs[k], &c);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAXPY(x, c, d_sol_vecs[k]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAXPY(d_r, -c, d_img_vecs[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecNorm(d_r, NORM_2, &d_projected_residual_norm);
+    IBTK_CHKERRQ(ierr);
+
+    // Keep the initial guess so that the correction computed by the Krylov
+    // method can be recovered by update().
+    ierr = VecCopy(x, d_x0);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_form_initial_guess);
+    return;
+} // formInitialGuess
+
+void
+PETScKrylovRecycleSpace::update(Mat A, Vec x)
+{
+    if (d_max_size == 0 || !d_x0) return;
+
+    IBTK_TIMER_START(t_update);
+
+    int ierr;
+
+    // Compute the correction and its image under the operator.
+    Vec v, q;
+    ierr = VecDuplicate(x, &v);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecWAXPY(v, -1.0, d_x0, x);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(x, &q);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMult(A, v, q);
+    IBTK_CHKERRQ(ierr);
+    appendOrthonormalized(v, q);
+    truncate(d_max_size);
+
+    IBTK_TIMER_STOP(t_update);
+    return;
+} // update
+
+void
+PETScKrylovRecycleSpace::reset()
+{
+    truncate(0);
+    int ierr;
+    if (d_x0)
+    {
+        ierr = VecDestroy(&d_x0);
+        IBTK_CHKERRQ(ierr);
+        d_x0 = NULL;
+    }
+    if (d_r)
+    {
+        ierr = VecDestroy(&d_r);
+        IBTK_CHKERRQ(ierr);
+        d_r = NULL;
+    }
+    d_initial_residual_norm = 0.0;
+    d_projected_residual_norm = 0.0;
+    return;
+} // reset
+
+double
+PETScKrylovRecycleSpace::getInitialResidualNorm() const
+{
+    return d_initial_residual_norm;
+} // getInitialResidualNorm
+
+double
+PETScKrylovRecycleSpace::getProjectedResidualNorm() const
+{
+    return d_projected_residual_norm;
+} // getProjectedResidualNorm
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PETScKrylovRecycleSpace::appendOrthonormalized(Vec v, Vec q)
+{
+    int ierr;
+    double q_norm_initial;
+    ierr = VecNorm(q, NORM_2, &q_norm_initial);
+    IBTK_CHKERRQ(ierr);
+
+    // Orthogonalize the image against the retained images using two passes of
+    // modified Gram-Schmidt, applying the same transformation to the
+    // correction so that q = A v continues to hold.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int k = 0; k < d_sol_vecs.size(); ++k)
+        {
+            PetscScalar c;
+            ierr = VecDot(q, d_img_vecs[k], &c);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(q, -c, d_img_vecs[k]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(v, -c, d_sol_vecs[k]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    double q_norm;
+    ierr = VecNorm(q, NORM_2, &q_norm);
+    IBTK_CHKERRQ(ierr);
+
+    if (q_norm > REL_ORTHOGONALIZATION_TOL * q_norm_initial && q_norm > 0.0)
+    {
+        ierr = VecScale(v, 1.0 / q_norm);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale(q, 1.0 / q_norm);
+        IBTK_CHKERRQ(ierr);
+        d_sol_vecs.push_back(v);
+        d_img_vecs.push_back(q);
+    }
+    else
+    {
+        ierr = VecDestroy(&v);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&q);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // appendOrthonormalized
+
+void
+PETScKrylovRecycleSpace::truncate(const int size)
+{
+    // Removing vectors from an orthonormal set leaves it orthonormal.
+    int ierr;
+    while (static_cast<int>(d_sol_vecs.size()) > size)
+    {
+        ierr = VecDestroy(&d_sol_vecs.front());
+        IBTK_CHKERRQ(ierr);
+        d_sol_vecs.pop_front();
+        ierr = VecDestroy(&d_img_vecs.front());
+        IBTK_CHKERRQ(ierr);
+        d_img_vecs.pop_front();
+    }
+    return;
+} // truncate
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
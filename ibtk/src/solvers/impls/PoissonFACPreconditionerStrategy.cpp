@@ -38,15 +38,21 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
 #include "CoarsenSchedule.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -90,6 +96,13 @@ static Timer* t_prolong_error;
 static Timer* t_prolong_error_and_correct;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Return the nonnegative remainder of n modulo 2.
+inline int
+parity(const int n)
+{
+    return ((n % 2) + 2) % 2;
+} // parity
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -125,6 +138,15 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_coarse_solver_abs_residual_tol(1.0e-50),
       d_coarse_solver_max_iterations(10),
       d_context(NULL),
+      d_smoother_gcw(1),
+      d_halo_sol_idx(-1),
+      d_halo_rhs_idx(-1),
+      d_deep_halo_level(),
+      d_patch_halo_boxes(),
+      d_chebyshev_eig_estimate_iterations(10),
+      d_chebyshev_lower_eig_fraction(0.3),
+      d_chebyshev_upper_eig_factor(1.1),
+      d_chebyshev_eig_max(),
       d_bc_op(NULL),
       d_cf_bdry_op(),
       d_op_stencil_fill_pattern(),
@@ -138,7 +160,11 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_ghostfill_nocoarse_refine_algorithm(),
       d_ghostfill_nocoarse_refine_schedules(),
       d_synch_refine_algorithm(),
-      d_synch_refine_schedules()
+      d_synch_refine_schedules(),
+      d_halo_fill_refine_algorithm(),
+      d_halo_sol_fill_refine_algorithm(),
+      d_halo_fill_refine_schedules(),
+      d_halo_sol_fill_refine_schedules()
 {
     // Initialize the Poisson specifications.
     d_poisson_spec.setCZero();
@@ -173,7 +199,21 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("smoother_ghost_cell_width"))
+            d_smoother_gcw = input_db->getInteger("smoother_ghost_cell_width");
+        if (input_db->keyExists("chebyshev_eig_estimate_iterations"))
+            d_chebyshev_eig_estimate_iterations = input_db->getInteger("chebyshev_eig_estimate_iterations");
+        if (input_db->keyExists("chebyshev_lower_eig_fraction"))
+            d_chebyshev_lower_eig_fraction = input_db->getDouble("chebyshev_lower_eig_fraction");
+        if (input_db->keyExists("chebyshev_upper_eig_factor"))
+            d_chebyshev_upper_eig_factor = input_db->getDouble("chebyshev_upper_eig_factor");
     }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_smoother_gcw >= 1);
+    TBOX_ASSERT(d_chebyshev_eig_estimate_iterations >= 0);
+    TBOX_ASSERT(d_chebyshev_lower_eig_fraction > 0.0);
+    TBOX_ASSERT(d_chebyshev_lower_eig_fraction < d_chebyshev_upper_eig_factor);
+#endif
 
     // Setup scratch variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -186,6 +226,18 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
         var_db->removePatchDataIndex(d_scratch_idx);
     }
     d_scratch_idx = var_db->registerVariableAndContext(scratch_var, d_context, ghosts);
+    if (d_smoother_gcw > 1)
+    {
+        const IntVector<NDIM> halo_ghosts = d_smoother_gcw;
+        Pointer<VariableContext> halo_sol_context = var_db->getContext(d_object_name + "::HALO_SOL_CONTEXT");
+        Pointer<VariableContext> halo_rhs_context = var_db->getContext(d_object_name + "::HALO_RHS_CONTEXT");
+        d_halo_sol_idx = var_db->mapVariableAndContextToIndex(scratch_var, halo_sol_context);
+        if (d_halo_sol_idx >= 0) var_db->removePatchDataIndex(d_halo_sol_idx);
+        d_halo_sol_idx = var_db->registerVariableAndContext(scratch_var, halo_sol_context, halo_ghosts);
+        d_halo_rhs_idx = var_db->mapVariableAndContextToIndex(scratch_var, halo_rhs_context);
+        if (d_halo_rhs_idx >= 0) var_db->removePatchDataIndex(d_halo_rhs_idx);
+        d_halo_rhs_idx = var_db->registerVariableAndContext(scratch_var, halo_rhs_context, halo_ghosts);
+    }
 
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -411,6 +463,56 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     d_coarsest_ln = solution.getCoarsestLevelNumber();
     d_finest_ln = solution.getFinestLevelNumber();
 
+    // Determine where communication-avoiding smoothing may be used.  We
+    // restrict it to levels that cover the physical domain, so that every
+    // ghost cell value is either provided by a neighboring patch or set by the
+    // physical boundary conditions.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    d_deep_halo_level.resize(d_finest_ln + 1, false);
+    d_patch_halo_boxes.resize(d_finest_ln + 1);
+    for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
+    {
+        d_deep_halo_level[ln] = false;
+        d_patch_halo_boxes[ln].clear();
+        if (d_smoother_gcw <= 1) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        BoxList<NDIM> uncovered_boxes(level->getPhysicalDomain());
+        uncovered_boxes.removeIntersections(BoxList<NDIM>(level->getBoxes()));
+        if (!uncovered_boxes.isEmpty()) continue;
+        d_deep_halo_level[ln] = true;
+
+        // Cells lying across periodic boundaries are images of interior cells
+        // and may be updated redundantly.
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level->getRatio());
+        IntVector<NDIM> periodic_growth(0);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (periodic_shift(d) != 0) periodic_growth(d) = d_smoother_gcw;
+        }
+        BoxList<NDIM> extended_domain_boxes(level->getPhysicalDomain());
+        extended_domain_boxes.grow(periodic_growth);
+
+        const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+        d_patch_halo_boxes[ln].resize(num_local_patches);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            BoxList<NDIM>& halo_boxes = d_patch_halo_boxes[ln][patch_counter];
+            halo_boxes = BoxList<NDIM>(Box<NDIM>::grow(patch_box, d_smoother_gcw - 1));
+            halo_boxes.intersectBoxes(extended_domain_boxes);
+            halo_boxes.removeIntersections(patch_box);
+        }
+    }
+
+    // Discard eigenvalue estimates on the levels that are being reset.
+    d_chebyshev_eig_max.resize(d_finest_ln + 1, -1.0);
+    for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
+    {
+        d_chebyshev_eig_max[ln] = -1.0;
+    }
+
     // Perform implementation-specific initialization.
     initializeOperatorStateSpecialized(solution, rhs, coarsest_reset_ln, finest_reset_ln);
 #if !defined(NDEBUG)
@@ -438,12 +540,16 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         if (!level->checkAllocated(d_scratch_idx)) level->allocatePatchData(d_scratch_idx);
+        if (d_deep_halo_level[ln])
+        {
+            if (!level->checkAllocated(d_halo_sol_idx)) level->allocatePatchData(d_halo_sol_idx);
+            if (!level->checkAllocated(d_halo_rhs_idx)) level->allocatePatchData(d_halo_rhs_idx);
+        }
     }
 
     // Get the transfer operators.
-    Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
-    d_prolongation_refine_operator = geometry->lookupRefineOperator(sol_var, d_prolongation_method);
-    d_restriction_coarsen_operator = geometry->lookupCoarsenOperator(sol_var, d_restriction_method);
+    d_prolongation_refine_operator = grid_geometry->lookupRefineOperator(sol_var, d_prolongation_method);
+    d_restriction_coarsen_operator = grid_geometry->lookupCoarsenOperator(sol_var, d_restriction_method);
     d_cf_bdry_op->setConsistentInterpolationScheme(false);
     d_cf_bdry_op->setPatchDataIndex(d_scratch_idx);
     d_cf_bdry_op->setPatchHierarchy(d_hierarchy);
@@ -461,6 +567,8 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     d_restriction_coarsen_schedules.resize(d_finest_ln);
     d_ghostfill_nocoarse_refine_schedules.resize(d_finest_ln + 1);
     d_synch_refine_schedules.resize(d_finest_ln + 1);
+    d_halo_fill_refine_schedules.resize(d_finest_ln + 1);
+    d_halo_sol_fill_refine_schedules.resize(d_finest_ln + 1);
 
     d_prolongation_refine_algorithm = new RefineAlgorithm<NDIM>();
     d_restriction_coarsen_algorithm = new CoarsenAlgorithm<NDIM>();
@@ -474,6 +582,20 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
         sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
     d_synch_refine_algorithm->registerRefine(
         sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_synch_fill_pattern);
+    if (d_smoother_gcw > 1)
+    {
+        // NOTE: The deep ghost cell regions are filled without a fill pattern
+        // because corner values are required by the redundant relaxation
+        // passes.
+        d_halo_fill_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_halo_fill_refine_algorithm->registerRefine(
+            d_halo_sol_idx, d_halo_sol_idx, d_halo_sol_idx, Pointer<RefineOperator<NDIM> >());
+        d_halo_fill_refine_algorithm->registerRefine(
+            d_halo_rhs_idx, d_halo_rhs_idx, d_halo_rhs_idx, Pointer<RefineOperator<NDIM> >());
+        d_halo_sol_fill_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_halo_sol_fill_refine_algorithm->registerRefine(
+            d_halo_sol_idx, d_halo_sol_idx, d_halo_sol_idx, Pointer<RefineOperator<NDIM> >());
+    }
 
     // TODO: Here we take a pessimistic approach and are recreating refine schedule for
     // (coarsest_reset_ln - 1) level as well.
@@ -498,6 +620,18 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
         d_ghostfill_nocoarse_refine_schedules[ln] =
             d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_bc_op.getPointer());
         d_synch_refine_schedules[ln] = d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln));
+        if (d_deep_halo_level[ln])
+        {
+            d_halo_fill_refine_schedules[ln] =
+                d_halo_fill_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_bc_op.getPointer());
+            d_halo_sol_fill_refine_schedules[ln] =
+                d_halo_sol_fill_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_bc_op.getPointer());
+        }
+        else
+        {
+            d_halo_fill_refine_schedules[ln].setNull();
+            d_halo_sol_fill_refine_schedules[ln].setNull();
+        }
     }
 
     // Indicate that the operator is initialized.
@@ -530,6 +664,11 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         if (level->checkAllocated(d_scratch_idx)) level->deallocatePatchData(d_scratch_idx);
+        if (d_smoother_gcw > 1)
+        {
+            if (level->checkAllocated(d_halo_sol_idx)) level->deallocatePatchData(d_halo_sol_idx);
+            if (level->checkAllocated(d_halo_rhs_idx)) level->deallocatePatchData(d_halo_rhs_idx);
+        }
     }
 
     // Delete the solution and rhs vectors.
@@ -564,6 +703,16 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
 
         d_synch_refine_algorithm.setNull();
         d_synch_refine_schedules.resize(0);
+
+        d_halo_fill_refine_algorithm.setNull();
+        d_halo_sol_fill_refine_algorithm.setNull();
+        d_halo_fill_refine_schedules.resize(0);
+        d_halo_sol_fill_refine_schedules.resize(0);
+
+        d_deep_halo_level.clear();
+        d_patch_halo_boxes.clear();
+
+        d_chebyshev_eig_max.clear();
     }
 
     // Clear the "reset level" range.
@@ -658,6 +807,295 @@ PoissonFACPreconditionerStrategy::xeqScheduleDataSynch(const int dst_idx, const
     return;
 } // xeqScheduleDataSynch
 
+void
+PoissonFACPreconditionerStrategy::xeqScheduleDeepHaloFill(const int dst_ln, const bool fill_rhs)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(useDeepHaloSmoothing(dst_ln));
+#endif
+    d_bc_op->setPatchDataIndex(d_halo_sol_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(d_halo_sol_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    if (fill_rhs)
+    {
+        d_halo_fill_refine_schedules[dst_ln]->fillData(d_solution_time);
+    }
+    else
+    {
+        d_halo_sol_fill_refine_schedules[dst_ln]->fillData(d_solution_time);
+    }
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // xeqScheduleDeepHaloFill
+
+bool
+PoissonFACPreconditionerStrategy::useDeepHaloSmoothing(const int ln) const
+{
+    return d_smoother_gcw > 1 && ln >= 0 && ln < static_cast<int>(d_deep_halo_level.size()) && d_deep_halo_level[ln];
+} // useDeepHaloSmoothing
+
+void
+PoissonFACPreconditionerStrategy::setDeepHaloPhysicalBoundaryConditions(const int ln)
+{
+    d_bc_op->setPatchDataIndex(d_halo_sol_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(d_halo_sol_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    const IntVector<NDIM> ghost_width_to_fill = d_smoother_gcw;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+        {
+            d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, ghost_width_to_fill);
+        }
+    }
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // setDeepHaloPhysicalBoundaryConditions
+
+void
+PoissonFACPreconditionerStrategy::redBlackSmoothBox(ArrayData<NDIM, double>& U_data,
+                                                    const ArrayData<NDIM, double>& F_data,
+                                                    const ArrayData<NDIM, int>* const mask_data,
+                                                    const Box<NDIM>& box,
+                                                    const int depth,
+                                                    const double* const dx,
+                                                    const int red_or_black) const
+{
+    if (box.empty()) return;
+
+    const Box<NDIM>& U_box = U_data.getBox();
+    const Box<NDIM>& F_box = F_data.getBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_box.contains(Box<NDIM>::grow(box, 1)));
+    TBOX_ASSERT(F_box.contains(box));
+    if (mask_data) TBOX_ASSERT(mask_data->getBox().contains(box));
+#endif
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    double fac[NDIM];
+    double diag = -beta;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+        diag += 2.0 * fac[d];
+    }
+    const double diag_inv = 1.0 / diag;
+
+    // Compute array strides.
+    int U_stride[NDIM], F_stride[NDIM], M_stride[NDIM];
+    U_stride[0] = F_stride[0] = M_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        U_stride[d] = U_stride[d - 1] * U_box.numberCells(d - 1);
+        F_stride[d] = F_stride[d - 1] * F_box.numberCells(d - 1);
+        M_stride[d] = mask_data ? M_stride[d - 1] * mask_data->getBox().numberCells(d - 1) : 0;
+    }
+    double* const U = U_data.getPointer(depth);
+    const double* const F = F_data.getPointer(depth);
+    const int* const mask = mask_data ? mask_data->getPointer() : NULL;
+
+    // Loop over the "red" ("black") indices, for which the sum of the index
+    // components is even (odd), one line in the first coordinate direction at
+    // a time.
+    Box<NDIM> line_box(box);
+    line_box.upper(0) = line_box.lower(0);
+    for (Box<NDIM>::Iterator b(line_box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        int i_sum = 0;
+        for (unsigned int d = 1; d < NDIM; ++d) i_sum += i(d);
+        const int i0_lower = box.lower(0) + parity(red_or_black - box.lower(0) - i_sum);
+        int U_offset = i0_lower - U_box.lower(0);
+        int F_offset = i0_lower - F_box.lower(0);
+        int M_offset = mask_data ? i0_lower - mask_data->getBox().lower(0) : 0;
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            U_offset += (i(d) - U_box.lower(d)) * U_stride[d];
+            F_offset += (i(d) - F_box.lower(d)) * F_stride[d];
+            if (mask_data) M_offset += (i(d) - mask_data->getBox().lower(d)) * M_stride[d];
+        }
+        for (int i0 = i0_lower; i0 <= box.upper(0); i0 += 2, U_offset += 2, F_offset += 2, M_offset += 2)
+        {
+            if (mask && mask[M_offset] != 0) continue;
+            double U_new = -F[F_offset];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                U_new += fac[d] * (U[U_offset - U_stride[d]] + U[U_offset + U_stride[d]]);
+            }
+            U[U_offset] = U_new * diag_inv;
+        }
+    }
+    return;
+} // redBlackSmoothBox
+
+void
+PoissonFACPreconditionerStrategy::computeJacobiCorrectionBox(ArrayData<NDIM, double>& Z_data,
+                                                             const ArrayData<NDIM, double>& U_data,
+                                                             const ArrayData<NDIM, double>* const F_data,
+                                                             const ArrayData<NDIM, int>* const mask_data,
+                                                             const Box<NDIM>& box,
+                                                             const int depth,
+                                                             const double* const dx) const
+{
+    if (box.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Z_data.getBox().contains(box));
+    TBOX_ASSERT(U_data.getBox().contains(Box<NDIM>::grow(box, 1)));
+    if (F_data) TBOX_ASSERT(F_data->getBox().contains(box));
+    if (mask_data) TBOX_ASSERT(mask_data->getBox().contains(box));
+#endif
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    double fac[NDIM];
+    double diag = -beta;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+        diag += 2.0 * fac[d];
+    }
+    const double diag_inv = 1.0 / diag;
+    int U_stride[NDIM];
+    U_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        U_stride[d] = U_stride[d - 1] * U_data.getBox().numberCells(d - 1);
+    }
+    const double* const U = U_data.getPointer(depth);
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        if (mask_data && (*mask_data)(i, 0) != 0)
+        {
+            Z_data(i, depth) = 0.0;
+            continue;
+        }
+        const int U_offset = U_data.getBox().offset(i);
+        double AU = -diag * U[U_offset];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            AU += fac[d] * (U[U_offset - U_stride[d]] + U[U_offset + U_stride[d]]);
+        }
+        const double F = F_data ? (*F_data)(i, depth) : 0.0;
+        Z_data(i, depth) = (AU - F) * diag_inv;
+    }
+    return;
+} // computeJacobiCorrectionBox
+
+void
+PoissonFACPreconditionerStrategy::chebyshevUpdateBox(ArrayData<NDIM, double>& U_data,
+                                                     ArrayData<NDIM, double>& D_data,
+                                                     const ArrayData<NDIM, double>& F_data,
+                                                     const ArrayData<NDIM, int>* const mask_data,
+                                                     const Box<NDIM>& box,
+                                                     const int depth,
+                                                     const double* const dx,
+                                                     const double d_coef,
+                                                     const double z_coef) const
+{
+    if (box.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(D_data.getBox().contains(box));
+#endif
+    // Compute the new direction from the current iterate, and only then update
+    // the iterate, so that the update is a Jacobi-type update.
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    double fac[NDIM];
+    double diag = -beta;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+        diag += 2.0 * fac[d];
+    }
+    const double diag_inv = 1.0 / diag;
+    int U_stride[NDIM];
+    U_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        U_stride[d] = U_stride[d - 1] * U_data.getBox().numberCells(d - 1);
+    }
+    const double* const U = U_data.getPointer(depth);
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        if (mask_data && (*mask_data)(i, 0) != 0)
+        {
+            D_data(i, depth) = 0.0;
+            continue;
+        }
+        const int U_offset = U_data.getBox().offset(i);
+        double AU = -diag * U[U_offset];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            AU += fac[d] * (U[U_offset - U_stride[d]] + U[U_offset + U_stride[d]]);
+        }
+        const double D_old = (d_coef != 0.0 ? d_coef * D_data(i, depth) : 0.0);
+        D_data(i, depth) = D_old + z_coef * (AU - F_data(i, depth)) * diag_inv;
+    }
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        U_data(i, depth) += D_data(i, depth);
+    }
+    return;
+} // chebyshevUpdateBox
+
+void
+PoissonFACPreconditionerStrategy::getChebyshevCoefficients(const int iteration,
+                                                           const double eig_max,
+                                                           double& d_coef,
+                                                           double& z_coef) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(iteration >= 0);
+    TBOX_ASSERT(eig_max > 0.0);
+#endif
+    const double upper = d_chebyshev_upper_eig_factor * eig_max;
+    const double lower = d_chebyshev_lower_eig_fraction * eig_max;
+    const double theta = 0.5 * (upper + lower);
+    const double delta = 0.5 * (upper - lower);
+    const double sigma = theta / delta;
+    double rho = 1.0 / sigma;
+    d_coef = 0.0;
+    z_coef = 1.0 / theta;
+    for (int k = 1; k <= iteration; ++k)
+    {
+        const double rho_new = 1.0 / (2.0 * sigma - rho);
+        d_coef = rho_new * rho;
+        z_coef = 2.0 * rho_new / delta;
+        rho = rho_new;
+    }
+    return;
+} // getChebyshevCoefficients
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,691 @@
+// Filename: PoissonFFTLevelSolver.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <math.h>
+#include <stddef.h>
+#include <algorithm>
+#include <complex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonFFTLevelSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+#include "unsupported/Eigen/FFT"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PoissonFFTLevelSolver::PoissonFFTLevelSolver()
+    : d_hierarchy(),
+      d_level_num(-1),
+      d_level(),
+      d_domain_box(),
+      d_num_fft_comps(0),
+      d_slab_lower(),
+      d_column_lower(),
+      d_slab_transpose_counts(),
+      d_slab_transpose_displs(),
+      d_column_transpose_counts(),
+      d_column_transpose_displs(),
+      d_to_fft_maps(),
+      d_from_fft_maps(),
+      d_fft_values(),
+      d_value_send_buf(),
+      d_value_recv_buf(),
+      d_slab_data(),
+      d_column_data(),
+      d_transpose_buf(),
+      d_line_in(),
+      d_line_out()
+{
+    // Setup default options.
+    d_max_iterations = 1;
+    d_abs_residual_tol = 0.0;
+    d_rel_residual_tol = 0.0;
+    d_initial_guess_nonzero = false;
+    d_enable_logging = false;
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::PoissonFFTLevelSolver::solveSystem()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::PoissonFFTLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::PoissonFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // PoissonFFTLevelSolver
+
+PoissonFFTLevelSolver::~PoissonFFTLevelSolver()
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::~PoissonFFTLevelSolver()\n"
+                                 << "  subclass must call deallocateSolverState in subclass destructor"
+                                 << std::endl);
+    }
+    return;
+} // ~PoissonFFTLevelSolver
+
+bool
+PoissonFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    if (d_enable_logging) plog << d_object_name << "::solveSystem():" << std::endl;
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // The problem coefficients must be spatially uniform.
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::solveSystem()\n"
+                                 << "  FFT solver requires constant C and D coefficients"
+                                 << std::endl);
+    }
+    const double C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    const double D = d_poisson_spec.getDConstant();
+
+    // Solve the system independently for each data component.  The locally
+    // owned right-hand-side values are sent to the processes that own the
+    // corresponding slabs, and the solution values are retrieved from them.
+    for (int fft_comp = 0; fft_comp < d_num_fft_comps; ++fft_comp)
+    {
+        d_fft_values.clear();
+        copyToFFTData(d_fft_values, b, fft_comp);
+        scatterToSlabs(d_to_fft_maps[fft_comp], d_fft_values);
+        solvePeriodicSystem(C, D);
+        gatherFromSlabs(d_from_fft_maps[fft_comp], d_fft_values);
+        copyFromFFTData(x, d_fft_values, fft_comp);
+    }
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solved " << d_num_fft_comps << " periodic system(s) with "
+             << d_domain_box.size() << " unknowns each" << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return true;
+} // solveSystem
+
+void
+PoissonFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                             const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+// Rudimentary error checking.
+#if !defined(NDEBUG)
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components"
+                                 << std::endl);
+    }
+
+    const Pointer<PatchHierarchy<NDIM> >& patch_hierarchy = x.getPatchHierarchy();
+    if (patch_hierarchy != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy"
+                                 << std::endl);
+    }
+
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same range of levels"
+                                 << std::endl);
+    }
+#endif
+    if (x.getCoarsestLevelNumber() != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in PoissonFFTLevelSolver"
+                                 << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+
+    // Ensure that the level covers a periodic, single-box computational domain.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    const BoxArray<NDIM>& physical_domain = grid_geometry->getPhysicalDomain();
+    if (physical_domain.getNumberOfBoxes() != 1)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a single-box computational domain"
+                                 << std::endl);
+    }
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  FFT solver requires a computational domain that is periodic in all "
+                                        "directions"
+                                     << std::endl);
+        }
+    }
+    d_domain_box = Box<NDIM>::refine(physical_domain[0], ratio);
+    const BoxArray<NDIM>& level_boxes = d_level->getBoxes();
+    int num_level_cells = 0;
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+    {
+        num_level_cells += level_boxes[k].size();
+    }
+    if (num_level_cells != d_domain_box.size())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a patch level that covers the computational domain"
+                                 << std::endl);
+    }
+
+    // Compute the symbol of the discrete Laplacian along each direction.
+    const double* const dx_coarsest = grid_geometry->getDx();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int n = d_domain_box.numberCells(d);
+        const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+        d_laplace_symbol[d].resize(n);
+        for (int k = 0; k < n; ++k)
+        {
+            d_laplace_symbol[d][k] = (2.0 * cos(2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n)) - 2.0) /
+                                     (dx * dx);
+        }
+    }
+
+    // Partition the last coordinate direction into slabs and the first
+    // coordinate direction into columns.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_first = d_domain_box.numberCells(0);
+    const int n_last = d_domain_box.numberCells(NDIM - 1);
+    const int n_middle = d_domain_box.size() / (n_first * n_last);
+    d_slab_lower.resize(mpi_size + 1);
+    d_column_lower.resize(mpi_size + 1);
+    for (int rank = 0; rank <= mpi_size; ++rank)
+    {
+        d_slab_lower[rank] = static_cast<int>((static_cast<long>(rank) * n_last) / mpi_size);
+        d_column_lower[rank] = static_cast<int>((static_cast<long>(rank) * n_first) / mpi_size);
+    }
+    const int num_local_planes = d_slab_lower[mpi_rank + 1] - d_slab_lower[mpi_rank];
+    const int num_local_columns = d_column_lower[mpi_rank + 1] - d_column_lower[mpi_rank];
+    d_slab_data.resize(std::max(n_first * n_middle * num_local_planes, 1));
+    d_column_data.resize(std::max(num_local_columns * n_middle * n_last, 1));
+
+    // Setup the transpose communication pattern.  Counts and displacements are
+    // measured in real values.
+    d_slab_transpose_counts.resize(mpi_size);
+    d_slab_transpose_displs.resize(mpi_size);
+    d_column_transpose_counts.resize(mpi_size);
+    d_column_transpose_displs.resize(mpi_size);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        const int rank_columns = d_column_lower[rank + 1] - d_column_lower[rank];
+        const int rank_planes = d_slab_lower[rank + 1] - d_slab_lower[rank];
+        d_slab_transpose_counts[rank] = 2 * rank_columns * n_middle * num_local_planes;
+        d_slab_transpose_displs[rank] = 2 * d_column_lower[rank] * n_middle * num_local_planes;
+        d_column_transpose_counts[rank] = 2 * num_local_columns * n_middle * rank_planes;
+        d_column_transpose_displs[rank] = 2 * num_local_columns * n_middle * d_slab_lower[rank];
+    }
+    d_transpose_buf.resize(d_slab_data.size());
+
+    // Initialize the data mapping.
+    d_num_fft_comps = initializeSolverStateSpecialized(x, b);
+    d_to_fft_maps.resize(d_num_fft_comps);
+    d_from_fft_maps.resize(d_num_fft_comps);
+    std::vector<int> fft_offsets;
+    for (int fft_comp = 0; fft_comp < d_num_fft_comps; ++fft_comp)
+    {
+        fft_offsets.clear();
+        getFFTDataOffsets(fft_offsets, fft_comp, /*owned_only*/ true);
+        initializeFFTDataMap(d_to_fft_maps[fft_comp], fft_offsets);
+        fft_offsets.clear();
+        getFFTDataOffsets(fft_offsets, fft_comp, /*owned_only*/ false);
+        initializeFFTDataMap(d_from_fft_maps[fft_comp], fft_offsets);
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+PoissonFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // Deallocate the FFT work arrays.
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        std::vector<double>().swap(d_laplace_symbol[d]);
+    }
+    std::vector<int>().swap(d_slab_lower);
+    std::vector<int>().swap(d_column_lower);
+    std::vector<int>().swap(d_slab_transpose_counts);
+    std::vector<int>().swap(d_slab_transpose_displs);
+    std::vector<int>().swap(d_column_transpose_counts);
+    std::vector<int>().swap(d_column_transpose_displs);
+    std::vector<FFTDataMap>().swap(d_to_fft_maps);
+    std::vector<FFTDataMap>().swap(d_from_fft_maps);
+    std::vector<double>().swap(d_fft_values);
+    std::vector<double>().swap(d_value_send_buf);
+    std::vector<double>().swap(d_value_recv_buf);
+    std::vector<std::complex<double> >().swap(d_slab_data);
+    std::vector<std::complex<double> >().swap(d_column_data);
+    std::vector<std::complex<double> >().swap(d_transpose_buf);
+    std::vector<std::complex<double> >().swap(d_line_in);
+    std::vector<std::complex<double> >().swap(d_line_out);
+    d_num_fft_comps = 0;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+PoissonFFTLevelSolver::init(Pointer<Database> input_db)
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+    return;
+} // init
+
+int
+PoissonFFTLevelSolver::getFFTDataOffset(const Index<NDIM>& i) const
+{
+    const Index<NDIM>& lower = d_domain_box.lower();
+    int offset = 0;
+    int stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int n = d_domain_box.numberCells(d);
+        int i_d = (i(d) - lower(d)) % n;
+        if (i_d < 0) i_d += n;
+        offset += i_d * stride;
+        stride *= n;
+    }
+    return offset;
+} // getFFTDataOffset
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PoissonFFTLevelSolver::initializeFFTDataMap(FFTDataMap& map, const std::vector<int>& fft_offsets)
+{
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int plane_size = d_domain_box.size() / d_domain_box.numberCells(NDIM - 1);
+
+    // Order the local entries by the process that owns the slab containing
+    // them.
+    const int num_local = static_cast<int>(fft_offsets.size());
+    std::vector<int> owner(num_local);
+    map.local_counts.assign(mpi_size, 0);
+    for (int k = 0; k < num_local; ++k)
+    {
+        const int plane = fft_offsets[k] / plane_size;
+        owner[k] =
+            static_cast<int>(std::upper_bound(d_slab_lower.begin(), d_slab_lower.end(), plane) - d_slab_lower.begin()) -
+            1;
+        ++map.local_counts[owner[k]];
+    }
+    map.local_displs.assign(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        map.local_displs[rank] = map.local_displs[rank - 1] + map.local_counts[rank - 1];
+    }
+    map.local_perm.resize(num_local);
+    std::vector<int> send_buf(std::max(num_local, 1));
+    std::vector<int> next_pos(map.local_displs);
+    for (int k = 0; k < num_local; ++k)
+    {
+        map.local_perm[k] = next_pos[owner[k]]++;
+        send_buf[map.local_perm[k]] = fft_offsets[k] - d_slab_lower[owner[k]] * plane_size;
+    }
+
+    // Send the slab offsets of the entries to the processes that own them.
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    map.slab_counts.resize(mpi_size);
+    MPI_Alltoall(&map.local_counts[0], 1, MPI_INT, &map.slab_counts[0], 1, MPI_INT, communicator);
+    map.slab_displs.assign(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        map.slab_displs[rank] = map.slab_displs[rank - 1] + map.slab_counts[rank - 1];
+    }
+    const int num_slab = map.slab_displs[mpi_size - 1] + map.slab_counts[mpi_size - 1];
+    map.slab_offsets.resize(std::max(num_slab, 1));
+    MPI_Alltoallv(&send_buf[0],
+                  &map.local_counts[0],
+                  &map.local_displs[0],
+                  MPI_INT,
+                  &map.slab_offsets[0],
+                  &map.slab_counts[0],
+                  &map.slab_displs[0],
+                  MPI_INT,
+                  communicator);
+    map.slab_offsets.resize(num_slab);
+    return;
+} // initializeFFTDataMap
+
+void
+PoissonFFTLevelSolver::scatterToSlabs(const FFTDataMap& map, const std::vector<double>& fft_values)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(fft_values.size() == map.local_perm.size());
+#endif
+    const size_t num_local = map.local_perm.size();
+    const size_t num_slab = map.slab_offsets.size();
+    d_value_send_buf.resize(std::max(num_local, static_cast<size_t>(1)));
+    d_value_recv_buf.resize(std::max(num_slab, static_cast<size_t>(1)));
+    for (size_t k = 0; k < num_local; ++k)
+    {
+        d_value_send_buf[map.local_perm[k]] = fft_values[k];
+    }
+    MPI_Alltoallv(&d_value_send_buf[0],
+                  const_cast<int*>(&map.local_counts[0]),
+                  const_cast<int*>(&map.local_displs[0]),
+                  MPI_DOUBLE,
+                  &d_value_recv_buf[0],
+                  const_cast<int*>(&map.slab_counts[0]),
+                  const_cast<int*>(&map.slab_displs[0]),
+                  MPI_DOUBLE,
+                  SAMRAI_MPI::getCommunicator());
+    std::fill(d_slab_data.begin(), d_slab_data.end(), 0.0);
+    for (size_t j = 0; j < num_slab; ++j)
+    {
+        d_slab_data[map.slab_offsets[j]] = d_value_recv_buf[j];
+    }
+    return;
+} // scatterToSlabs
+
+void
+PoissonFFTLevelSolver::gatherFromSlabs(const FFTDataMap& map, std::vector<double>& fft_values)
+{
+    const size_t num_local = map.local_perm.size();
+    const size_t num_slab = map.slab_offsets.size();
+    d_value_send_buf.resize(std::max(num_slab, static_cast<size_t>(1)));
+    d_value_recv_buf.resize(std::max(num_local, static_cast<size_t>(1)));
+    for (size_t j = 0; j < num_slab; ++j)
+    {
+        d_value_send_buf[j] = d_slab_data[map.slab_offsets[j]].real();
+    }
+    MPI_Alltoallv(&d_value_send_buf[0],
+                  const_cast<int*>(&map.slab_counts[0]),
+                  const_cast<int*>(&map.slab_displs[0]),
+                  MPI_DOUBLE,
+                  &d_value_recv_buf[0],
+                  const_cast<int*>(&map.local_counts[0]),
+                  const_cast<int*>(&map.local_displs[0]),
+                  MPI_DOUBLE,
+                  SAMRAI_MPI::getCommunicator());
+    fft_values.resize(num_local);
+    for (size_t k = 0; k < num_local; ++k)
+    {
+        fft_values[k] = d_value_recv_buf[map.local_perm[k]];
+    }
+    return;
+} // gatherFromSlabs
+
+void
+PoissonFFTLevelSolver::transposeSlabsToColumns()
+{
+    // The local slab data is packed by destination process.  Each process
+    // receives the lines of each slab as a contiguous block of its column
+    // data, because the last coordinate direction varies slowest.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_first = d_domain_box.numberCells(0);
+    const int num_local_rows = (d_slab_lower[mpi_rank + 1] - d_slab_lower[mpi_rank]) * d_domain_box.size() /
+                               (n_first * d_domain_box.numberCells(NDIM - 1));
+    int pos = 0;
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        for (int r = 0; r < num_local_rows; ++r)
+        {
+            for (int i = d_column_lower[rank]; i < d_column_lower[rank + 1]; ++i)
+            {
+                d_transpose_buf[pos++] = d_slab_data[r * n_first + i];
+            }
+        }
+    }
+    MPI_Alltoallv(reinterpret_cast<double*>(&d_transpose_buf[0]),
+                  &d_slab_transpose_counts[0],
+                  &d_slab_transpose_displs[0],
+                  MPI_DOUBLE,
+                  reinterpret_cast<double*>(&d_column_data[0]),
+                  &d_column_transpose_counts[0],
+                  &d_column_transpose_displs[0],
+                  MPI_DOUBLE,
+                  SAMRAI_MPI::getCommunicator());
+    return;
+} // transposeSlabsToColumns
+
+void
+PoissonFFTLevelSolver::transposeColumnsToSlabs()
+{
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_first = d_domain_box.numberCells(0);
+    const int num_local_rows = (d_slab_lower[mpi_rank + 1] - d_slab_lower[mpi_rank]) * d_domain_box.size() /
+                               (n_first * d_domain_box.numberCells(NDIM - 1));
+    MPI_Alltoallv(reinterpret_cast<double*>(&d_column_data[0]),
+                  &d_column_transpose_counts[0],
+                  &d_column_transpose_displs[0],
+                  MPI_DOUBLE,
+                  reinterpret_cast<double*>(&d_transpose_buf[0]),
+                  &d_slab_transpose_counts[0],
+                  &d_slab_transpose_displs[0],
+                  MPI_DOUBLE,
+                  SAMRAI_MPI::getCommunicator());
+    int pos = 0;
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        for (int r = 0; r < num_local_rows; ++r)
+        {
+            for (int i = d_column_lower[rank]; i < d_column_lower[rank + 1]; ++i)
+            {
+                d_slab_data[r * n_first + i] = d_transpose_buf[pos++];
+            }
+        }
+    }
+    return;
+} // transposeColumnsToSlabs
+
+void
+PoissonFFTLevelSolver::transformLines(std::vector<std::complex<double> >& data,
+                                      const int (&extents)[NDIM],
+                                      const unsigned int axis,
+                                      const bool forward)
+{
+    int size = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        size *= extents[d];
+    }
+    if (size == 0) return;
+    int stride = 1;
+    for (unsigned int d = 0; d < axis; ++d)
+    {
+        stride *= extents[d];
+    }
+    const int n = extents[axis];
+    d_line_in.resize(n);
+    d_line_out.resize(n);
+    Eigen::FFT<double> fft;
+    for (int k = 0; k < size; ++k)
+    {
+        // Visit each line along the axis once, starting from the entry with a
+        // zero index in that direction.
+        if ((k / stride) % n != 0) continue;
+        for (int i = 0; i < n; ++i)
+        {
+            d_line_in[i] = data[k + i * stride];
+        }
+        if (forward)
+        {
+            fft.fwd(d_line_out, d_line_in);
+        }
+        else
+        {
+            fft.inv(d_line_out, d_line_in);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            data[k + i * stride] = d_line_out[i];
+        }
+    }
+    return;
+} // transformLines
+
+void
+PoissonFFTLevelSolver::solvePeriodicSystem(const double C, const double D)
+{
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    int slab_extents[NDIM], column_extents[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        slab_extents[d] = column_extents[d] = d_domain_box.numberCells(d);
+    }
+    slab_extents[NDIM - 1] = d_slab_lower[mpi_rank + 1] - d_slab_lower[mpi_rank];
+    column_extents[0] = d_column_lower[mpi_rank + 1] - d_column_lower[mpi_rank];
+
+    // Transform along all but the last direction within each slab, and then
+    // along the last direction within each column.
+    for (unsigned int d = 0; d < NDIM - 1; ++d)
+    {
+        transformLines(d_slab_data, slab_extents, d, /*forward*/ true);
+    }
+    transposeSlabsToColumns();
+    transformLines(d_column_data, column_extents, NDIM - 1, /*forward*/ true);
+
+    // Divide by the symbol of the discrete operator.  When the operator is
+    // singular, the zero mode of the solution is set to zero.
+    int column_size = 1;
+    int stride[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        stride[d] = column_size;
+        column_size *= column_extents[d];
+    }
+    for (int k = 0; k < column_size; ++k)
+    {
+        double symbol = C + D * d_laplace_symbol[0][d_column_lower[mpi_rank] + k % column_extents[0]];
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            symbol += D * d_laplace_symbol[d][(k / stride[d]) % column_extents[d]];
+        }
+        if (symbol != 0.0)
+        {
+            d_column_data[k] /= symbol;
+        }
+        else
+        {
+            d_column_data[k] = 0.0;
+        }
+    }
+
+    // Transform back.
+    transformLines(d_column_data, column_extents, NDIM - 1, /*forward*/ false);
+    transposeColumnsToSlabs();
+    for (unsigned int d = 0; d < NDIM - 1; ++d)
+    {
+        transformLines(d_slab_data, slab_extents, d, /*forward*/ false);
+    }
+    return;
+} // solvePeriodicSystem
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,165 @@
+// Filename: SCPoissonFFTLevelSolver.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchLevel.h"
+#include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideGeometry.h"
+#include "SideIndex.h"
+#include "VariableDatabase.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/PoissonFFTLevelSolver.h"
+#include "ibtk/SCPoissonFFTLevelSolver.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SCPoissonFFTLevelSolver::SCPoissonFFTLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+    : d_depth(0)
+{
+    // Configure solver.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    PoissonFFTLevelSolver::init(input_db);
+    return;
+} // SCPoissonFFTLevelSolver
+
+SCPoissonFFTLevelSolver::~SCPoissonFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~SCPoissonFFTLevelSolver
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+int
+SCPoissonFFTLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& x,
+                                                          const SAMRAIVectorReal<NDIM, double>& /*b*/)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<SideDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x_fac);
+#endif
+    d_depth = x_fac->getDefaultDepth();
+    return NDIM * d_depth;
+} // initializeSolverStateSpecialized
+
+void
+SCPoissonFFTLevelSolver::getFFTDataOffsets(std::vector<int>& fft_offsets, const int fft_comp, const bool owned_only)
+{
+    // On a periodic domain, each side index is identified with the cell index
+    // on its upper side.  Each patch owns the lower sides of its cells, so that
+    // the sides shared by neighboring patches are counted only once.
+    const unsigned int axis = fft_comp % NDIM;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Box<NDIM> side_box = owned_only ? patch_box : SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        for (Box<NDIM>::Iterator b_it(side_box); b_it; b_it++)
+        {
+            fft_offsets.push_back(getFFTDataOffset(b_it()));
+        }
+    }
+    return;
+} // getFFTDataOffsets
+
+void
+SCPoissonFFTLevelSolver::copyToFFTData(std::vector<double>& fft_values,
+                                       const SAMRAIVectorReal<NDIM, double>& b,
+                                       const int fft_comp)
+{
+    const unsigned int axis = fft_comp % NDIM;
+    const int depth = fft_comp / NDIM;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<SideData<NDIM, double> > b_data = b.getComponentPatchData(0, *patch);
+        for (Box<NDIM>::Iterator b_it(patch_box); b_it; b_it++)
+        {
+            const SideIndex<NDIM> i_s(b_it(), axis, SideIndex<NDIM>::Lower);
+            fft_values.push_back((*b_data)(i_s, depth));
+        }
+    }
+    return;
+} // copyToFFTData
+
+void
+SCPoissonFFTLevelSolver::copyFromFFTData(SAMRAIVectorReal<NDIM, double>& x,
+                                         const std::vector<double>& fft_values,
+                                         const int fft_comp)
+{
+    const unsigned int axis = fft_comp % NDIM;
+    const int depth = fft_comp / NDIM;
+    int k = 0;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch->getBox(), axis);
+        Pointer<SideData<NDIM, double> > x_data = x.getComponentPatchData(0, *patch);
+        for (Box<NDIM>::Iterator b_it(side_box); b_it; b_it++, ++k)
+        {
+            const SideIndex<NDIM> i_s(b_it(), axis, SideIndex<NDIM>::Lower);
+            (*x_data)(i_s, depth) = fft_values[k];
+        }
+    }
+    return;
+} // copyFromFFTData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -217,6 +217,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -225,8 +226,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -408,6 +410,21 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Estimate the spectrum of the Jacobi-preconditioned operator the first
+    // time that Chebyshev smoothing is used on this level.
+    if (smoother_type == CHEBYSHEV && d_chebyshev_eig_max[level_num] < 0.0)
+    {
+        d_chebyshev_eig_max[level_num] = estimateChebyshevEigenvalue(error, level_num);
+    }
+
+    // Use communication-avoiding smoothing when it is enabled for this level.
+    if (red_black_ordering && useDeepHaloSmoothing(level_num))
+    {
+        smoothErrorDeepHalo(error, residual, level_num, 2 * num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -530,6 +547,35 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 d_bc_helper->copyDataAtDirichletBoundaries(error_data, residual_data, patch);
             }
 
+            // Perform a Chebyshev iteration.
+            if (smoother_type == CHEBYSHEV)
+            {
+                Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                double d_coef, z_coef;
+                getChebyshevCoefficients(isweep, d_chebyshev_eig_max[level_num], d_coef, z_coef);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    const ArrayData<NDIM, int>* const mask =
+                        (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis)) ?
+                            &mask_data->getArrayData(axis) :
+                            NULL;
+                    for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                    {
+                        chebyshevUpdateBox(error_data->getArrayData(axis),
+                                           scratch_data->getArrayData(axis),
+                                           residual_data->getArrayData(axis),
+                                           mask,
+                                           side_patch_box,
+                                           depth,
+                                           dx,
+                                           d_coef,
+                                           z_coef);
+                    }
+                }
+                continue;
+            }
+
             // Smooth the error using Gauss-Seidel.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
@@ -780,6 +826,15 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<SideDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_smoother_gcw > 1)
+    {
+        Pointer<SideDataFactory<NDIM, double> > halo_sol_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_halo_sol_idx);
+        halo_sol_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        Pointer<SideDataFactory<NDIM, double> > halo_rhs_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_halo_rhs_idx);
+        halo_rhs_pdat_fac->setDefaultDepth(rhs_pdat_fac->getDefaultDepth());
+    }
 
     // Setup cached BC data.
     d_bc_helper = new StaggeredPhysicalBoundaryHelper();
@@ -904,6 +959,218 @@ SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+double
+SCPoissonPointRelaxationFACOperator::estimateChebyshevEigenvalue(const SAMRAIVectorReal<NDIM, double>& error,
+                                                                 const int level_num)
+{
+    // Fall back on the Gershgorin bound when no power iterations are requested.
+    static const double GERSHGORIN_EIG_BOUND = 2.0;
+    if (d_chebyshev_eig_estimate_iterations == 0) return GERSHGORIN_EIG_BOUND;
+
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    Pointer<SAMRAIVectorReal<NDIM, double> > x = getLevelSAMRAIVectorReal(error, level_num)->cloneVector("");
+    Pointer<SAMRAIVectorReal<NDIM, double> > y = x->cloneVector("");
+    x->allocateVectorData();
+    y->allocateVectorData();
+
+    // Apply power iterations to D^{-1} A, treating coarse-fine interface ghost
+    // cell values as homogeneous Dirichlet boundary values.  Dirichlet boundary
+    // values are masked out.
+    double eig_max = 0.0;
+    x->setRandomValues(1.0, 0.0);
+    for (int k = 0; k < d_chebyshev_eig_estimate_iterations; ++k)
+    {
+        const double x_norm = x->L2Norm();
+        if (x_norm == 0.0) break;
+        x->scale(1.0 / x_norm, x);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > x_data = x->getComponentPatchData(0, *patch);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (BoxList<NDIM>::Iterator b(d_patch_bc_box_overlap[level_num][patch_counter][axis]); b; b++)
+                {
+                    x_data->getArrayData(axis).fillAll(0.0, b());
+                }
+            }
+        }
+        xeqScheduleGhostFillNoCoarse(x->getComponentDescriptorIndex(0), level_num);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > x_data = x->getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, double> > y_data = y->getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
+            const bool patch_has_dirichlet_bdry = d_bc_helper->patchTouchesDirichletBoundary(patch);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                const ArrayData<NDIM, int>* const mask =
+                    (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis)) ?
+                        &mask_data->getArrayData(axis) :
+                        NULL;
+                for (int depth = 0; depth < x_data->getDepth(); ++depth)
+                {
+                    computeJacobiCorrectionBox(y_data->getArrayData(axis),
+                                               x_data->getArrayData(axis),
+                                               NULL,
+                                               mask,
+                                               side_patch_box,
+                                               depth,
+                                               dx);
+                }
+            }
+        }
+        eig_max = y->L2Norm();
+        std::swap(x, y);
+    }
+
+    x->freeVectorComponents();
+    y->freeVectorComponents();
+    return eig_max > 0.0 ? eig_max : GERSHGORIN_EIG_BOUND;
+} // estimateChebyshevEigenvalue
+
+void
+SCPoissonPointRelaxationFACOperator::smoothErrorDeepHalo(SAMRAIVectorReal<NDIM, double>& error,
+                                                         const SAMRAIVectorReal<NDIM, double>& residual,
+                                                         const int level_num,
+                                                         const int num_passes)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+
+    // Determine the side-centered indices that may be redundantly updated.
+    // Values located on non-periodic physical boundaries are only updated by
+    // the patches that own them.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level->getRatio());
+    IntVector<NDIM> periodic_growth(0);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) != 0) periodic_growth(d) = d_smoother_gcw;
+    }
+    const Box<NDIM> domain_box =
+        Box<NDIM>::grow(BoxList<NDIM>(level->getPhysicalDomain()).getBoundingBox(), periodic_growth);
+    boost::array<Box<NDIM>, NDIM> interior_side_boxes;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        interior_side_boxes[axis] = SideGeometry<NDIM>::toSideBox(domain_box, axis);
+        if (periodic_shift(axis) == 0)
+        {
+            interior_side_boxes[axis].lower(axis) += 1;
+            interior_side_boxes[axis].upper(axis) -= 1;
+        }
+    }
+
+    // Copy the error and residual into the scratch data.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+        Pointer<SideData<NDIM, double> > F_data = patch->getPatchData(d_halo_rhs_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            U_data->getArrayData(axis).copy(error_data->getArrayData(axis), side_patch_box, IntVector<NDIM>(0));
+            F_data->getArrayData(axis).copy(residual_data->getArrayData(axis), side_patch_box, IntVector<NDIM>(0));
+        }
+    }
+
+    // Perform the relaxation passes.  Immediately after a ghost cell exchange,
+    // values are valid up to a distance of d_smoother_gcw cells from each
+    // patch, and each pass reduces the width of the valid region by one.
+    int pass = 0;
+    bool fill_rhs = true;
+    while (pass < num_passes)
+    {
+        const int num_block_passes = std::min(d_smoother_gcw, num_passes - pass);
+        for (int k = 0; k < num_block_passes; ++k, ++pass)
+        {
+            // Either exchange ghost cell values or reset physical boundary
+            // values, and enforce any Dirichlet boundary conditions.  Dirichlet
+            // values are also set prior to each exchange so that the values
+            // received from neighboring patches are consistent.
+            if (k == 0)
+            {
+                d_bc_helper->copyDataAtDirichletBoundaries(d_halo_sol_idx, d_halo_rhs_idx, level_num, level_num);
+                xeqScheduleDeepHaloFill(level_num, fill_rhs);
+                fill_rhs = false;
+            }
+            else
+            {
+                setDeepHaloPhysicalBoundaryConditions(level_num);
+            }
+            d_bc_helper->copyDataAtDirichletBoundaries(d_halo_sol_idx, d_halo_rhs_idx, level_num, level_num);
+
+            // Smooth the error on the patches and on their deep ghost cell
+            // regions.
+            const int red_or_black = pass % 2; // "red" = 0, "black" = 1
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Box<NDIM> update_box = Box<NDIM>::grow(patch_box, d_smoother_gcw - 1 - k);
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+                Pointer<SideData<NDIM, double> > F_data = patch->getPatchData(d_halo_rhs_idx);
+                Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
+                const bool patch_has_dirichlet_bdry = d_bc_helper->patchTouchesDirichletBoundary(patch);
+                const BoxList<NDIM>& halo_boxes = d_patch_halo_boxes[level_num][patch_counter];
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    BoxList<NDIM> side_halo_boxes;
+                    for (BoxList<NDIM>::Iterator b(halo_boxes); b; b++)
+                    {
+                        const Box<NDIM> halo_box = b() * update_box;
+                        if (!halo_box.empty()) side_halo_boxes.appendItem(SideGeometry<NDIM>::toSideBox(halo_box, axis));
+                    }
+                    side_halo_boxes.removeIntersections(side_patch_box);
+                    side_halo_boxes.intersectBoxes(interior_side_boxes[axis]);
+                    const ArrayData<NDIM, int>* const mask =
+                        (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis)) ?
+                            &mask_data->getArrayData(axis) :
+                            NULL;
+                    ArrayData<NDIM, double>& U = U_data->getArrayData(axis);
+                    const ArrayData<NDIM, double>& F = F_data->getArrayData(axis);
+                    for (int depth = 0; depth < U_data->getDepth(); ++depth)
+                    {
+                        redBlackSmoothBox(U, F, mask, side_patch_box, depth, dx, red_or_black);
+                        for (BoxList<NDIM>::Iterator b(side_halo_boxes); b; b++)
+                        {
+                            redBlackSmoothBox(U, F, NULL, b(), depth, dx, red_or_black);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Copy the smoothed error out of the scratch data.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_halo_sol_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            error_data->getArrayData(axis).copy(U_data->getArrayData(axis), side_patch_box, IntVector<NDIM>(0));
+        }
+    }
+    return;
+} // smoothErrorDeepHalo
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
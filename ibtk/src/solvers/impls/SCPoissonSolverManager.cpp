@@ -44,6 +44,7 @@
 #include "ibtk/PETScKrylovPoissonSolver.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCLaplaceOperator.h"
+#include "ibtk/SCPoissonFFTLevelSolver.h"
 #include "ibtk/SCPoissonHypreLevelSolver.h"
 #include "ibtk/SCPoissonPETScLevelSolver.h"
 #include "ibtk/SCPoissonPointRelaxationFACOperator.h"
@@ -69,6 +70,7 @@ const std::string SCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER =
 const std::string SCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string SCPoissonSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 
 SCPoissonSolverManager* SCPoissonSolverManager::s_solver_manager_instance = NULL;
 bool SCPoissonSolverManager::s_registered_callback = false;
@@ -175,6 +177,7 @@ SCPoissonSolverManager::SCPoissonSolverManager() : d_solver_maker_map()
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, SCPoissonPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, SCPoissonFFTLevelSolver::allocate_solver);
     return;
 } // SCPoissonSolverManager
 
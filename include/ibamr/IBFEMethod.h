@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <set>
 #include <stdbool.h>
 #include <stddef.h>
@@ -186,8 +187,27 @@ public:
      */
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function,
+     * which evaluates the stress at all of the quadrature points of an element
+     * (or of an element side) in a single call.
+     *
+     * \note The output vector PP is sized by the caller to match FF.
+     */
+    typedef void (*PK1StressBatchFcnPtr)(std::vector<libMesh::TensorValue<double> >& PP,
+                                         const std::vector<libMesh::TensorValue<double> >& FF,
+                                         const std::vector<libMesh::Point>& X,
+                                         const std::vector<libMesh::Point>& s,
+                                         libMesh::Elem* elem,
+                                         const std::vector<libMesh::NumericVector<double>*>& system_data,
+                                         double data_time,
+                                         void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * \note Either a pointwise or a batched stress function may be provided.
+     * If both are provided, the batched function is used.
      */
     struct PK1StressFcnData
     {
@@ -196,11 +216,21 @@ public:
                          void* ctx = NULL,
                          libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
                          libMesh::Order quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn), batch_fcn(NULL), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+        {
+        }
+
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         const std::vector<unsigned int>& systems = std::vector<unsigned int>(),
+                         void* ctx = NULL,
+                         libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
+                         libMesh::Order quad_order = libMesh::INVALID_ORDER)
+            : fcn(NULL), batch_fcn(batch_fcn), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
         {
         }
 
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn;
         std::vector<unsigned int> systems;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -223,6 +253,22 @@ public:
                                    libMesh::Order quad_order = libMesh::INVALID_ORDER,
                                    unsigned int part = 0);
 
+    /*!
+     * Register the (optional) batched function to compute the first
+     * Piola-Kirchhoff stress tensor, used to compute the forces on the
+     * Lagrangian finite element mesh.
+     *
+     * \note It is possible to register multiple PK1 stress functions with this
+     * class.  This is intended to be used to implement selective reduced
+     * integration.
+     */
+    void registerPK1StressFunction(PK1StressBatchFcnPtr batch_fcn,
+                                   const std::vector<unsigned int>& systems = std::vector<unsigned int>(),
+                                   void* ctx = NULL,
+                                   libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
+                                   libMesh::Order quad_order = libMesh::INVALID_ORDER,
+                                   unsigned int part = 0);
+
     /*!
      * Register the (optional) function to compute the first Piola-Kirchhoff
      * stress tensor, used to compute the forces on the Lagrangian finite
@@ -366,6 +412,20 @@ public:
      */
     void registerLagSurfaceForceFunction(const LagSurfaceForceFcnData& data, unsigned int part = 0);
 
+    /*!
+     * Indicate that the specified part is a thin-walled structure with the
+     * specified reference wall thickness, so that the force density should be
+     * spread only from the surface of the part, i.e., from element sides
+     * without neighbors.
+     *
+     * In this mode, the integral of the force density through the thickness of
+     * the wall is approximated by the trapezoidal rule applied to the two
+     * surfaces of the wall, and volumetric quadrature is skipped altogether.
+     * Surface quadrature rules are selected adaptively using the spreading
+     * specification.  A nonpositive thickness restores volumetric spreading.
+     */
+    void setSurfaceSpreadingThickness(double wall_thickness, unsigned int part = 0);
+
     /*!
      * Return the number of ghost cells required by the Lagrangian-Eulerian
      * interaction routines.
@@ -470,6 +530,17 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Indicate whether the patch hierarchy should be regridded (and hence
+     * load balanced) at the specified integrator step.
+     *
+     * \note When a load balancer has been registered and a positive value of
+     * the input key workload_rebalance_interval is specified, this method
+     * requests regridding at that interval so that measured force evaluation
+     * costs are used to rebalance the workload between regular regrids.
+     */
+    bool requiresRegrid(int integrator_step) const;
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -551,6 +622,34 @@ protected:
                                         double data_time,
                                         unsigned int part);
 
+    /*!
+     * \brief Spread the interior force density of a thin-walled structure from
+     * the surface of the Lagrangian mesh (i.e., from element sides without
+     * neighbors) only.
+     */
+    void spreadSurfaceForceDensity(int f_data_idx,
+                                   libMesh::PetscVector<double>& F_ghost_vec,
+                                   libMesh::PetscVector<double>& X_ghost_vec,
+                                   IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                   double data_time,
+                                   unsigned int part);
+
+    /*!
+     * \brief Spread a force density along the boundary of the Lagrangian
+     * structure using surface quadrature rules.
+     *
+     * If F_ghost_vec is non-NULL, the surface force density of a thin-walled
+     * structure is spread (see spreadSurfaceForceDensity()); otherwise, the
+     * transmission force density is spread (see
+     * spreadTransmissionForceDensity()).
+     */
+    void spreadBoundaryForceDensity(int f_data_idx,
+                                    libMesh::PetscVector<double>* F_ghost_vec,
+                                    libMesh::PetscVector<double>& X_ghost_vec,
+                                    IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                    double data_time,
+                                    unsigned int part);
+
     /*!
      * \brief Impose jump conditions determined from the interior and
      * transmission force densities along the physical boundary of the
@@ -620,6 +719,14 @@ protected:
     libMesh::QuadratureType d_quad_type;
     libMesh::Order d_quad_order;
     bool d_use_consistent_mass_matrix;
+    bool d_repartition_fe_mesh;
+
+    /*
+     * Reference wall thicknesses of parts whose force densities are spread
+     * only from their physical boundaries (nonpositive values indicate that
+     * volumetric spreading is used).
+     */
+    std::vector<double> d_surface_spreading_thickness;
 
     /*
      * Functions used to compute the initial coordinates of the Lagrangian mesh.
@@ -650,6 +757,16 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > d_load_balancer;
     int d_workload_idx;
 
+    /*
+     * Measured per-element force evaluation costs (wall clock time accumulated
+     * on this process since the last workload update, keyed by element ID),
+     * the weight given to these costs relative to the quadrature point counts,
+     * and the interval at which rebalancing is requested.
+     */
+    std::vector<std::map<unsigned int, double> > d_elem_force_cost;
+    double d_workload_force_cost_weight;
+    int d_workload_rebalance_interval;
+
     /*
      * The object name is used as a handle to databases stored in restart files
      * and for error reporting purposes.
@@ -712,6 +829,22 @@ private:
                            const std::string& restart_read_dirname,
                            unsigned int restart_restore_number);
 
+    /*!
+     * Return a pointer to the map used to accumulate per-element force
+     * evaluation costs for the specified part, or NULL if these costs are not
+     * being measured.
+     */
+    std::map<unsigned int, double>* getElementForceCostData(unsigned int part);
+
+    /*!
+     * Add the per-element force evaluation costs of the specified part to the
+     * workload estimates of the patches on the level to which the part is
+     * assigned, and reset the accumulated costs.  Costs are communicated from
+     * the process that measured them to a process that owns a patch
+     * intersecting the element, so this must be called on all processes.
+     */
+    void updateForceCostWorkloadEstimates(unsigned int part);
+
     /*!
      * Read input values from a given database.
      */
@@ -149,6 +149,30 @@ public:
      */
     SAMRAI::tbox::Pointer<IBInstrumentPanel> getIBInstrumentPanel() const;
 
+    /*!
+     * Set the number of Lagrangian substeps that are used when evaluating the
+     * Lagrangian force on the specified level of the patch hierarchy.  A
+     * negative level number sets the number of substeps on all levels.
+     *
+     * When n > 1 substeps are used, the structure is advanced from its
+     * position at the beginning of the time step with the velocity that is
+     * interpolated at the force evaluation time, X_{k+1} = X_k + (dt/n) U, and
+     * the force that is spread to the grid is the average of the forces
+     * evaluated at X_0, ..., X_{n-1} at times current_time + k dt/n.  Stiff
+     * structures may be placed on their own level and subcycled in this manner
+     * without reducing the time step of the fluid solver.
+     *
+     * \note This may also be set via the input database entry
+     * "lagrangian_substeps", which is an array of values for each level.
+     */
+    void setNumberOfLagrangianSubsteps(int num_substeps, int level_number = -1);
+
+    /*!
+     * Return the number of Lagrangian substeps that are used when evaluating
+     * the Lagrangian force on the specified level of the patch hierarchy.
+     */
+    int getNumberOfLagrangianSubsteps(int level_number) const;
+
     /*!
      * Register a Lagrangian Silo data writer so this class will write plot
      * files that may be postprocessed with the VisIt visualization tool.
@@ -543,6 +567,14 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Number of Lagrangian substeps used when evaluating the Lagrangian force
+     * on each level, along with scratch data used by the substeps.  The last
+     * entry applies to all finer levels.
+     */
+    std::vector<int> d_num_lagrangian_substeps;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_substep_data, d_F_substep_data;
+
     /*
      * List of local indices of local anchor points.
      *
@@ -353,6 +353,16 @@ public:
     virtual void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                          int workload_data_idx);
 
+    /*!
+     * Indicate whether the IB strategy object requires the patch hierarchy to
+     * be regridded at the specified integrator step, e.g., to rebalance the
+     * workload, independent of the regrid interval of the hierarchy
+     * integrator.
+     *
+     * A default implementation is provided that returns false.
+     */
+    virtual bool requiresRegrid(int integrator_step) const;
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
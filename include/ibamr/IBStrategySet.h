@@ -281,6 +281,12 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Indicate whether any of the IB strategy objects requires the patch
+     * hierarchy to be regridded at the specified integrator step.
+     */
+    bool requiresRegrid(int integrator_step) const;
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -357,6 +357,45 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Whether the FFT-based level solvers are used by default for the velocity
+     * and pressure subdomain solvers and to precondition the regrid projection.
+     * This is only valid for single-level grids on fully periodic, single-box
+     * computational domains.
+     */
+    bool d_use_fft_subdomain_solvers;
+
+    /*
+     * Solver setup reuse.
+     *
+     * The coefficients and boundary conditions used when the subdomain and
+     * Stokes solvers were last set up are recorded so that solver setup can be
+     * skipped when none of them have changed.  The reaction coefficient C of
+     * the velocity problem, which changes with the time step size, may drift
+     * from its setup value by up to a relative tolerance of
+     * d_solver_setup_reuse_rel_tol before the solvers are set up again.
+     *
+     * A nonzero tolerance only affects the preconditioner: the outer Krylov
+     * operators always use the current value of C, but any component that is
+     * built from C during setup keeps using the setup value.  This includes the
+     * coarse-level solvers, the box relaxation inverses and PETSc level
+     * smoothers of StaggeredStokesLevelRelaxationFACOperator, a
+     * StaggeredStokesPETScLevelSolver used as the preconditioner, and the
+     * eigenvalue estimates of Chebyshev smoothers.
+     */
+    double d_solver_setup_reuse_rel_tol;
+    double d_velocity_solver_setup_C, d_velocity_solver_setup_D;
+    double d_pressure_solver_setup_D;
+    double d_stokes_solver_setup_C, d_stokes_solver_setup_D, d_stokes_solver_setup_P_D;
+    std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_solver_setup_bc_coefs;
+    TractionBcType d_solver_setup_traction_bc_type;
+
+    /*!
+     * Wall-clock time spent setting up solvers since the last logged Stokes
+     * solve.  Only accumulated when logging is enabled.
+     */
+    double d_solver_setup_time;
+
     /*!
      * Fluid solver variables.
      */
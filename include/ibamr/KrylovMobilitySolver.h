@@ -41,6 +41,7 @@
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PETScKrylovRecycleSpace.h"
 #include "petscksp.h"
 #include "tbox/Database.h"
 #include "tbox/DescribedClass.h"
@@ -319,6 +320,9 @@ private:
     bool d_initial_guess_nonzero;
     bool d_enable_logging;
 
+    // Previous solution corrections used to form initial guesses.
+    IBTK::PETScKrylovRecycleSpace d_recycle_space;
+
     // Velocity BCs and cached communication operators for interpolation operation.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_u_bc_coefs;
@@ -40,9 +40,6 @@
 #include <vector>
 
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
 #include "tbox/Pointer.h"
 
 namespace boost
@@ -77,6 +74,14 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * The boxes are processed in lexicographic order unless the smoother type is
+ * "COLORED_MULTIPLICATIVE", in which case the boxes are processed in 3^NDIM
+ * colors.  Boxes of the same color are at least three cells apart in each
+ * direction, so that no box reads unknowns that are updated by another box of
+ * the same color.  The cells of each color are visited by striding through the
+ * patch box, and the precomputed dense box inverse is applied to batches of
+ * boxes of the same color at once.
 */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -164,11 +169,10 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that);
 
     /*
-     * Box operator data.
+     * Dense inverses of the (single-cell) box operators, stored in row-major
+     * order for each level of the patch hierarchy.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<std::vector<double> > d_box_inv;
 
     /*
      * Mappings from patch indices to patch operators.
@@ -108,7 +108,14 @@ namespace IBAMR
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
+ coarse_solver_gmg_min_cells = 32768            // see setCoarseSolverGMGMinCells()
  \endverbatim
+ *
+ * When \a coarse_solver_type is not provided in the input database, the
+ * coarse level solver is selected automatically: a
+ * StaggeredStokesGMGLevelSolver is used when the coarsest level is level 0 and
+ * has at least \a coarse_solver_gmg_min_cells cells, and the level smoother is
+ * used otherwise.
 */
 class StaggeredStokesFACPreconditionerStrategy : public IBTK::FACPreconditionerStrategy
 {
@@ -199,6 +206,16 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type);
 
+    /*!
+     * \brief Set the minimum number of cells on level 0 for which geometric
+     * multigrid is automatically used as the coarse level solver.
+     *
+     * A nonpositive value disables the automatic selection of geometric
+     * multigrid.  The automatic selection only applies when the coarse level
+     * solver type is not provided in the input database.
+     */
+    void setCoarseSolverGMGMinCells(int coarse_solver_gmg_min_cells);
+
     /*!
      * \brief Set the maximum number of iterations for the coarse level solve.
      *
@@ -462,6 +479,8 @@ protected:
      */
     bool d_coarse_solver_init_subclass;
     std::string d_coarse_solver_type, d_coarse_solver_default_options_prefix;
+    bool d_coarse_solver_auto_select;
+    int d_coarse_solver_gmg_min_cells;
     double d_coarse_solver_rel_residual_tol;
     double d_coarse_solver_abs_residual_tol;
     int d_coarse_solver_max_iterations;
@@ -0,0 +1,284 @@
+// Filename: StaggeredStokesGMGLevelSolver.h
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBAMR_StaggeredStokesGMGLevelSolver
+#define included_IBAMR_StaggeredStokesGMGLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "PatchHierarchy.h"
+#include "SAMRAIVectorReal.h"
+#include "ibamr/StaggeredStokesSolver.h"
+#include "ibtk/LinearSolver.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+namespace IBAMR
+{
+class StaggeredStokesFACPreconditioner;
+class StaggeredStokesFACPreconditionerStrategy;
+class StaggeredStokesPhysicalBoundaryHelper;
+} // namespace IBAMR
+namespace SAMRAI
+{
+namespace solv
+{
+class PoissonSpecifications;
+template <int DIM>
+class RobinBcCoefStrategy;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class StaggeredStokesGMGLevelSolver is a level solver for a
+ * staggered-grid (MAC) discretization of the incompressible Stokes equations
+ * that uses geometric multigrid on a private hierarchy of coarsened copies of
+ * the level.
+ *
+ * The solver is intended to be used as the coarse level solver of a
+ * StaggeredStokesFACPreconditionerStrategy, via
+ *
+ \verbatim
+ coarse_solver_type = "GMG_LEVEL_SOLVER"
+ \endverbatim
+ *
+ * It is also selected automatically when no coarse level solver type is
+ * specified and level 0 is sufficiently large; see
+ * StaggeredStokesFACPreconditionerStrategy::setCoarseSolverGMGMinCells().
+ *
+ * When the solver state is initialized, the grid geometry and the boxes of the
+ * level are repeatedly coarsened by a factor of two, for as long as the boxes
+ * and the physical domain remain coarsenable and the coarsened domain has more
+ * than \a max_coarsest_level_cells cells.  The coarsened levels retain the
+ * processor mapping of the original level, so that the finest multigrid level
+ * is an exact copy of the original level and transfers between the two are
+ * purely local.  The system is then solved by applying FAC cycles of a
+ * StaggeredStokesFACPreconditioner (with a StaggeredStokesLevelRelaxationFACOperator
+ * strategy) to the residual until the prescribed tolerances are met.  By
+ * default, velocity corrections are prolonged by
+ * IBTK::CartSideDoubleSpecializedLinearRefine and velocity residuals are
+ * restricted by IBTK::CartSideDoubleRT0Coarsen.
+ *
+ * A StaggeredStokesPhysicalBoundaryHelper is built for the multigrid hierarchy
+ * and is passed to the multigrid preconditioner.  Normal velocity boundary
+ * conditions are imposed at Dirichlet boundaries on the solution and on the
+ * residual computed on the finest multigrid level.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ max_coarsening_levels = 16                        // maximum number of levels added below the solved level
+ max_coarsest_level_cells = 4096                   // stop coarsening once the domain has no more cells than this
+ U_prolongation_method = "SPECIALIZED_LINEAR_REFINE"
+ P_prolongation_method = "LINEAR_REFINE"
+ U_restriction_method = "RT0_COARSEN"
+ P_restriction_method = "CONSERVATIVE_COARSEN"
+ \endverbatim
+ *
+ * All other entries of the database (e.g., \a cycle_type, \a num_pre_sweeps,
+ * \a coarse_solver_type and \a coarse_solver_db) are used to configure the
+ * multigrid preconditioner that is applied on the coarsened hierarchy.
+ *
+ * \note Like the other coarse level solvers, this solver is used to solve for
+ * the error, and so homogeneous boundary conditions are always employed.
+ *
+ * \note Only levels with a refinement ratio of one relative to level 0 (i.e.,
+ * levels that are not refined relative to the coarsest level of the patch
+ * hierarchy) are supported.
+ */
+class StaggeredStokesGMGLevelSolver : public IBTK::LinearSolver, public StaggeredStokesSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    StaggeredStokesGMGLevelSolver(const std::string& object_name,
+                                  SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                  const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StaggeredStokesGMGLevelSolver();
+
+    /*!
+     * \brief Static function to construct a StaggeredStokesGMGLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        return new StaggeredStokesGMGLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \brief Set the PoissonSpecifications object used to specify the
+     * coefficients for the momentum equation in the incompressible Stokes
+     * operator.
+     */
+    void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
+    /*!
+     * \brief Set if velocity and pressure have nullspace.
+     */
+    void setComponentsHaveNullspace(const bool has_velocity_nullspace, const bool has_pressure_nullspace);
+
+    /*!
+     * \brief Set the SAMRAI::solv::RobinBcCoefStrategy objects used to specify
+     * physical boundary conditions.
+     */
+    void setPhysicalBcCoefs(const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& U_bc_coefs,
+                            SAMRAI::solv::RobinBcCoefStrategy<NDIM>* P_bc_coef);
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * \return \p true if the solver converged to the specified tolerances, \p
+     * false otherwise
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * This builds the coarsened multigrid hierarchy and initializes the
+     * multigrid preconditioner on it.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     */
+    void deallocateSolverState();
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    StaggeredStokesGMGLevelSolver();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StaggeredStokesGMGLevelSolver(const StaggeredStokesGMGLevelSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StaggeredStokesGMGLevelSolver& operator=(const StaggeredStokesGMGLevelSolver& that);
+
+    /*!
+     * \brief Impose normal velocity boundary conditions at Dirichlet
+     * boundaries on the finest level of the multigrid vector \a v.
+     */
+    void enforceNormalVelocityBoundaryConditions(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& v, bool homogeneous_bc);
+
+    /*!
+     * \brief Copy the data on level \a src_ln of \a src to level \a dst_ln of
+     * \a dst.
+     *
+     * \note The two levels must have identical box arrays and processor
+     * mappings.
+     */
+    void copyLevelData(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& dst,
+                       int dst_ln,
+                       const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& src,
+                       int src_ln);
+
+    /*!
+     * \name Multigrid configuration.
+     */
+    //\{
+
+    int d_max_coarsening_levels;
+    int d_max_coarsest_level_cells;
+    SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditionerStrategy> d_mg_strategy;
+    SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditioner> d_mg_solver;
+
+    //\}
+
+    /*!
+     * \name Hierarchy-dependent multigrid data.
+     */
+    //\{
+
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_mg_hierarchy;
+    int d_mg_finest_ln;
+    SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> d_mg_bc_helper;
+    double d_mg_bc_coef_time;
+    std::vector<int> d_mg_x_idxs;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_mg_x, d_mg_b, d_mg_r, d_mg_e;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_mg_x_fine, d_mg_b_fine, d_mg_r_fine,
+        d_mg_e_fine;
+
+    //\}
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_StaggeredStokesGMGLevelSolver
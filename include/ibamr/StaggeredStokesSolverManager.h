@@ -85,6 +85,7 @@ public:
      */
     static const std::string DEFAULT_LEVEL_SOLVER;
     static const std::string PETSC_LEVEL_SOLVER;
+    static const std::string GMG_LEVEL_SOLVER;
 
     /*!
      * Return a pointer to the instance of the solver manager.  Access to
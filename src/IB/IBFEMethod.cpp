@@ -46,7 +46,9 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellIndex.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyDataOpsManager.h"
@@ -193,6 +195,61 @@ has_physical_bdry(const Elem* elem, const BoundaryInfo& boundary_info, const Dof
     return has_physical_bdry;
 }
 
+inline bool
+has_PK1_stress_fcn(const IBFEMethod::PK1StressFcnData& data)
+{
+    return data.fcn || data.batch_fcn;
+}
+
+// Evaluate the PK1 stress at a collection of points, using the batched stress
+// function if one is provided and otherwise evaluating the pointwise stress
+// function at each point.
+void
+compute_PK1_stress(std::vector<TensorValue<double> >& PP,
+                   const std::vector<TensorValue<double> >& FF,
+                   const std::vector<libMesh::Point>& X,
+                   const std::vector<libMesh::Point>& s,
+                   Elem* const elem,
+                   const std::vector<NumericVector<double>*>& system_data,
+                   const double data_time,
+                   const IBFEMethod::PK1StressFcnData& data)
+{
+    PP.resize(FF.size());
+    if (data.batch_fcn)
+    {
+        data.batch_fcn(PP, FF, X, s, elem, system_data, data_time, data.ctx);
+        return;
+    }
+    for (unsigned int qp = 0; qp < FF.size(); ++qp)
+    {
+        data.fcn(PP[qp], FF[qp], X[qp], s[qp], elem, system_data, data_time, data.ctx);
+    }
+    return;
+}
+
+// Evaluate the PK1 stress at a single point.
+inline void
+compute_PK1_stress(TensorValue<double>& PP,
+                   const TensorValue<double>& FF,
+                   const libMesh::Point& X,
+                   const libMesh::Point& s,
+                   Elem* const elem,
+                   const std::vector<NumericVector<double>*>& system_data,
+                   const double data_time,
+                   const IBFEMethod::PK1StressFcnData& data)
+{
+    if (data.fcn)
+    {
+        data.fcn(PP, FF, X, s, elem, system_data, data_time, data.ctx);
+        return;
+    }
+    std::vector<TensorValue<double> > PP_vec(1), FF_vec(1, FF);
+    std::vector<libMesh::Point> X_vec(1, X), s_vec(1, s);
+    data.batch_fcn(PP_vec, FF_vec, X_vec, s_vec, elem, system_data, data_time, data.ctx);
+    PP = PP_vec[0];
+    return;
+}
+
 std::string
 libmesh_restart_file_name(const std::string& restart_dump_dirname,
                           unsigned int time_step_number,
@@ -301,6 +358,18 @@ IBFEMethod::registerPK1StressFunction(PK1StressFcnPtr fcn,
     return;
 } // registerPK1StressFunction
 
+void
+IBFEMethod::registerPK1StressFunction(PK1StressBatchFcnPtr batch_fcn,
+                                      const std::vector<unsigned int>& systems,
+                                      void* ctx,
+                                      QuadratureType quad_type,
+                                      Order quad_order,
+                                      const unsigned int part)
+{
+    registerPK1StressFunction(PK1StressFcnData(batch_fcn, systems, ctx, quad_type, quad_order), part);
+    return;
+} // registerPK1StressFunction
+
 void
 IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsigned int part)
 {
@@ -379,6 +448,14 @@ IBFEMethod::registerLagSurfaceForceFunction(const LagSurfaceForceFcnData& data,
     return;
 } // registerLagSurfaceForceFunction
 
+void
+IBFEMethod::setSurfaceSpreadingThickness(const double wall_thickness, const unsigned int part)
+{
+    TBOX_ASSERT(part < d_num_parts);
+    d_surface_spreading_thickness[part] = wall_thickness;
+    return;
+} // setSurfaceSpreadingThickness
+
 const IntVector<NDIM>&
 IBFEMethod::getMinimumGhostCellWidth() const
 {
@@ -500,6 +577,18 @@ IBFEMethod::postprocessIntegrateData(double /*current_time*/, double /*new_time*
 
         // Update the coordinate mapping dX = X - s.
         updateCoordinateMapping(part);
+
+        // Report and reset the L2 projection solver, quadrature, and
+        // localization statistics for this step.
+        if (d_do_log)
+        {
+            d_fe_data_managers[part]->printL2ProjectionStatistics(plog);
+            d_fe_data_managers[part]->printQuadratureStatistics(plog);
+            d_fe_data_managers[part]->printLocalizationStatistics(plog);
+        }
+        d_fe_data_managers[part]->resetL2ProjectionStatistics();
+        d_fe_data_managers[part]->resetQuadratureStatistics();
+        d_fe_data_managers[part]->resetLocalizationStatistics();
     }
 
     d_X_systems.clear();
@@ -550,7 +639,8 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
             X_vec = d_X_new_vecs[part];
             U_vec = d_U_new_vecs[part];
         }
-        X_vec->localize(*X_ghost_vec);
+        d_fe_data_managers[part]->localizeGhostedVectors(std::vector<NumericVector<double>*>(1, X_vec),
+                                                         std::vector<NumericVector<double>*>(1, X_ghost_vec));
         d_fe_data_managers[part]->interp(
             u_data_idx, *U_vec, *X_ghost_vec, VELOCITY_SYSTEM_NAME, u_ghost_fill_scheds, data_time);
     }
@@ -638,10 +728,37 @@ IBFEMethod::spreadForce(const int f_data_idx,
         PetscVector<double>* X_ghost_vec = d_X_IB_ghost_vecs[part];
         PetscVector<double>* F_vec = d_F_half_vecs[part];
         PetscVector<double>* F_ghost_vec = d_F_IB_ghost_vecs[part];
-        X_vec->localize(*X_ghost_vec);
-        F_vec->localize(*F_ghost_vec);
-        d_fe_data_managers[part]->spread(
-            f_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME, f_phys_bdry_op, data_time);
+        std::vector<NumericVector<double>*> vecs(2), ghost_vecs(2);
+        vecs[0] = X_vec;
+        vecs[1] = F_vec;
+        ghost_vecs[0] = X_ghost_vec;
+        ghost_vecs[1] = F_ghost_vec;
+        if (d_split_forces)
+        {
+            // The transmission force computations use ghosted copies of the
+            // systems (e.g., the velocity) that are passed to the force
+            // functions.  These are localized along with X and F.
+            EquationSystems* equation_systems = d_fe_data_managers[part]->getEquationSystems();
+            for (std::set<unsigned int>::const_iterator cit = d_fcn_systems[part].begin();
+                 cit != d_fcn_systems[part].end();
+                 ++cit)
+            {
+                const std::string& system_name = equation_systems->get_system(*cit).name();
+                vecs.push_back(d_fe_data_managers[part]->getSolutionVector(system_name));
+                ghost_vecs.push_back(
+                    d_fe_data_managers[part]->buildGhostedSolutionVector(system_name, /*localize_data*/ false));
+            }
+        }
+        d_fe_data_managers[part]->localizeGhostedVectors(vecs, ghost_vecs);
+        if (d_surface_spreading_thickness[part] > 0.0)
+        {
+            spreadSurfaceForceDensity(f_data_idx, *F_ghost_vec, *X_ghost_vec, f_phys_bdry_op, data_time, part);
+        }
+        else
+        {
+            d_fe_data_managers[part]->spread(
+                f_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME, f_phys_bdry_op, data_time);
+        }
         if (d_split_forces)
         {
             if (d_use_jump_conditions)
@@ -797,10 +914,18 @@ IBFEMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
         d_fe_data_managers[part]->updateWorkloadEstimates();
+        updateForceCostWorkloadEstimates(part);
     }
     return;
 } // updateWorkloadEstimates
 
+bool
+IBFEMethod::requiresRegrid(const int integrator_step) const
+{
+    return d_load_balancer && d_workload_rebalance_interval > 0 && integrator_step > 0 &&
+           integrator_step % d_workload_rebalance_interval == 0;
+} // requiresRegrid
+
 void IBFEMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -815,6 +940,7 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
     {
         for (unsigned int part = 0; part < d_num_parts; ++part)
         {
+            if (d_repartition_fe_mesh) d_fe_data_managers[part]->repartitionMesh();
             d_fe_data_managers[part]->reinitElementMappings();
         }
     }
@@ -924,6 +1050,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     const MeshBase& mesh = equation_systems->get_mesh();
     const BoundaryInfo& boundary_info = *mesh.boundary_info;
     const unsigned int dim = mesh.mesh_dimension();
+    std::map<unsigned int, double>* const elem_force_cost = getElementForceCostData(part);
 
     // Setup extra data needed to compute stresses/forces.
     for (std::set<unsigned int>::const_iterator cit = d_fcn_systems[part].begin(); cit != d_fcn_systems[part].end();
@@ -992,7 +1119,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     // First handle the stress contributions.
     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        if (!has_PK1_stress_fcn(d_PK1_stress_fcn_data[part][k])) continue;
 
         AutoPtr<QBase> qrule =
             QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
@@ -1036,15 +1163,17 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         //
         // This right-hand side vector is used to solve for the nodal values of
         // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
+        TensorValue<double> FF_inv_trans;
         VectorValue<double> F, F_qp, n;
-        libMesh::Point X_qp;
+        std::vector<TensorValue<double> > PP_qp, FF_qp;
+        std::vector<libMesh::Point> X_qps;
         boost::multi_array<double, 2> X_node;
         const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
         const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
         for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
         {
             Elem* const elem = *el_it;
+            const double elem_start_time = elem_force_cost ? MPI_Wtime() : 0.0;
             fe->reinit(elem);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
@@ -1054,23 +1183,40 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dof_indices[0].size();
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+
+            // Compute the values of the first Piola-Kirchhoff stress tensor at
+            // all of the quadrature points of the element at once.
+            FF_qp.resize(n_qp);
+            X_qps.resize(n_qp);
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& s_qp = q_point[qp];
-                interpolate(X_qp, qp, X_node, phi);
-                jacobian(FF, qp, X_node, dphi);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                interpolate(X_qps[qp], qp, X_node, phi);
+                jacobian(FF_qp[qp], qp, X_node, dphi);
+            }
+            compute_PK1_stress(PP_qp,
+                               FF_qp,
+                               X_qps,
+                               q_point,
+                               elem,
+                               PK1_stress_fcn_data[k],
+                               data_time,
+                               d_PK1_stress_fcn_data[part][k]);
+
+            // Add the corresponding forces to the right-hand-side vector.
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                const TensorValue<double> PP_JxW = PP_qp[qp] * JxW[qp];
                 for (unsigned int k = 0; k < n_basis; ++k)
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
+                    const VectorValue<double>& dphi_k = dphi[k][qp];
                     for (unsigned int i = 0; i < NDIM; ++i)
                     {
-                        G_rhs_e[i](k) += F_qp(i);
+                        double G = 0.0;
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            G += PP_JxW(i, j) * dphi_k(j);
+                        }
+                        G_rhs_e[i](k) -= G;
                     }
                 }
             }
@@ -1092,28 +1238,31 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                 const unsigned int n_qp = qrule_face->n_points();
                 const size_t n_basis = dof_indices[0].size();
                 get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+
+                // Compute the values of the first Piola-Kirchhoff stress tensor
+                // at all of the quadrature points along the side at once.
+                FF_qp.resize(n_qp);
+                X_qps.resize(n_qp);
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    const libMesh::Point& s_qp = q_point_face[qp];
-                    interpolate(X_qp, qp, X_node, phi_face);
-                    jacobian(FF, qp, X_node, dphi_face);
-                    F.zero();
+                    interpolate(X_qps[qp], qp, X_node, phi_face);
+                    jacobian(FF_qp[qp], qp, X_node, dphi_face);
+                }
+                compute_PK1_stress(PP_qp,
+                                   FF_qp,
+                                   X_qps,
+                                   q_point_face,
+                                   elem,
+                                   PK1_stress_fcn_data[k],
+                                   data_time,
+                                   d_PK1_stress_fcn_data[part][k]);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const TensorValue<double>& FF = FF_qp[qp];
 
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
-                    {
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           X_qp,
-                                                           s_qp,
-                                                           elem,
-                                                           PK1_stress_fcn_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
+                    // Add the force corresponding to the first Piola-Kirchhoff
+                    // stress tensor to the right-hand-side vector.
+                    F = PP_qp[qp] * normal_face[qp];
 
                     // If we are imposing jump conditions, then we keep only the
                     // normal part of the force.  This has the effect of
@@ -1145,6 +1294,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                 dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
                 G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
             }
+            if (elem_force_cost) (*elem_force_cost)[elem->id()] += MPI_Wtime() - elem_start_time;
         }
     }
 
@@ -1196,6 +1346,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
         {
             Elem* const elem = *el_it;
+            const double elem_start_time = elem_force_cost ? MPI_Wtime() : 0.0;
             fe->reinit(elem);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
@@ -1323,6 +1474,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                 dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
                 G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
             }
+            if (elem_force_cost) (*elem_force_cost)[elem->id()] += MPI_Wtime() - elem_start_time;
         }
     }
 
@@ -1342,6 +1494,39 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
                                            const unsigned int part)
 {
     if (!d_split_forces) return;
+    spreadBoundaryForceDensity(f_data_idx, NULL, X_ghost_vec, f_phys_bdry_op, data_time, part);
+    return;
+} // spreadTransmissionForceDensity
+
+void
+IBFEMethod::spreadSurfaceForceDensity(const int f_data_idx,
+                                      PetscVector<double>& F_ghost_vec,
+                                      PetscVector<double>& X_ghost_vec,
+                                      RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                      const double data_time,
+                                      const unsigned int part)
+{
+    spreadBoundaryForceDensity(f_data_idx, &F_ghost_vec, X_ghost_vec, f_phys_bdry_op, data_time, part);
+    return;
+} // spreadSurfaceForceDensity
+
+void
+IBFEMethod::spreadBoundaryForceDensity(const int f_data_idx,
+                                       PetscVector<double>* const F_ghost_vec,
+                                       PetscVector<double>& X_ghost_vec,
+                                       RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                       const double data_time,
+                                       const unsigned int part)
+{
+    // When F_ghost_vec is provided, the interior force density of a
+    // thin-walled structure is spread from the free surface of the mesh.
+    // Otherwise, the transmission force density is computed and spread along
+    // the non-Dirichlet physical boundary of the mesh.
+    const bool spread_surface_force = F_ghost_vec != NULL;
+    const double thickness_weight = spread_surface_force ? 0.5 * d_surface_spreading_thickness[part] : 0.0;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!spread_surface_force || thickness_weight > 0.0);
+#endif
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -1366,6 +1551,7 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     const MeshBase& mesh = equation_systems->get_mesh();
     const BoundaryInfo& boundary_info = *mesh.boundary_info;
     const unsigned int dim = mesh.mesh_dimension();
+    std::map<unsigned int, double>* const elem_force_cost = getElementForceCostData(part);
     AutoPtr<QBase> qrule_face;
 
     // Extract the FE systems and DOF maps, and setup the FE object.
@@ -1393,14 +1579,18 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     }
 
     // Setup extra data needed to compute stresses/forces.
-    for (std::set<unsigned int>::const_iterator cit = d_fcn_systems[part].begin(); cit != d_fcn_systems[part].end();
-         ++cit)
+    if (!spread_surface_force)
     {
-        System& system = equation_systems->get_system(*cit);
-        system.update();
+        for (std::set<unsigned int>::const_iterator cit = d_fcn_systems[part].begin();
+             cit != d_fcn_systems[part].end();
+             ++cit)
+        {
+            System& system = equation_systems->get_system(*cit);
+            system.update();
+        }
     }
 
-    const size_t num_PK1_stress_fcns = d_PK1_stress_fcn_data[part].size();
+    const size_t num_PK1_stress_fcns = spread_surface_force ? 0 : d_PK1_stress_fcn_data[part].size();
     std::vector<std::vector<NumericVector<double>*> > PK1_stress_fcn_data(num_PK1_stress_fcns);
     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
     {
@@ -1445,15 +1635,29 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     }
 
     // Extract the underlying solution data.
-    PetscVector<double>* X_petsc_vec = dynamic_cast<PetscVector<double>*>(&X_ghost_vec);
-    Vec X_global_vec = X_petsc_vec->vec();
+    Vec F_global_vec = NULL;
+    Vec F_local_vec = NULL;
+    double* F_local_soln = NULL;
+    if (spread_surface_force)
+    {
+        F_global_vec = F_ghost_vec->vec();
+        VecGhostGetLocalForm(F_global_vec, &F_local_vec);
+        VecGetArray(F_local_vec, &F_local_soln);
+    }
+
+    Vec X_global_vec = X_ghost_vec.vec();
     Vec X_local_vec;
     VecGhostGetLocalForm(X_global_vec, &X_local_vec);
     double* X_local_soln;
     VecGetArray(X_local_vec, &X_local_soln);
 
-    // Loop over the patches to spread the transmission elastic force density
-    // onto the grid.
+    // Loop over the patches to spread the boundary force density onto the
+    // grid.
+    //
+    // NOTE: For thin-walled structures, the integral of the force density
+    // through the thickness of the wall is approximated by the trapezoidal rule
+    // using the values on the two surfaces of the wall, so that each surface
+    // quadrature point is weighted by one half of the wall thickness.
     const std::vector<std::vector<Elem*> >& active_patch_element_map =
         d_fe_data_managers[part]->getActivePatchElementMap();
     const int level_num = d_fe_data_managers[part]->getLevelNumber();
@@ -1461,7 +1665,7 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     VectorValue<double> F, F_s;
     libMesh::Point X_qp;
     double P;
-    boost::multi_array<double, 2> X_node, X_node_side;
+    boost::multi_array<double, 2> F_node, X_node, X_node_side;
     std::vector<double> T_bdry, X_bdry;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     int local_patch_num = 0;
@@ -1485,33 +1689,45 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
         for (size_t e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
             Elem* const elem = patch_elems[e_idx];
-            const bool touches_physical_bdry = has_physical_bdry(elem, boundary_info, dof_map);
-            if (!touches_physical_bdry) continue;
+            const bool touches_bdry = spread_surface_force ? elem->on_boundary() :
+                                                             has_physical_bdry(elem, boundary_info, dof_map);
+            if (!touches_bdry) continue;
+            const double elem_start_time = elem_force_cost ? MPI_Wtime() : 0.0;
 
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 dof_map.dof_indices(elem, dof_indices[d], d);
             }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+            if (spread_surface_force) get_values_for_interpolation(F_node, *F_ghost_vec, F_local_soln, dof_indices);
+            get_values_for_interpolation(X_node, X_ghost_vec, X_local_soln, dof_indices);
 
             // Loop over the element boundaries.
             for (unsigned short int side = 0; side < elem->n_sides(); ++side)
             {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
+                if (spread_surface_force)
+                {
+                    // Skip sides that are not on the surface of the mesh.
+                    if (elem->neighbor(side)) continue;
+                }
+                else
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
 
-                // Skip Dirichlet boundaries.
-                if (is_dirichlet_bdry(elem, side, boundary_info, dof_map)) continue;
+                    // Skip Dirichlet boundaries.
+                    if (is_dirichlet_bdry(elem, side, boundary_info, dof_map)) continue;
+                }
 
-                // Construct a side element.
+                // Determine the surface quadrature rule from the deformed
+                // configuration of the side.
                 AutoPtr<Elem> side_elem = elem->build_side(side);
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
                     dof_map.dof_indices(side_elem.get(), side_dof_indices[d], d);
                 }
-                get_values_for_interpolation(X_node_side, *X_petsc_vec, X_local_soln, side_dof_indices);
+                get_values_for_interpolation(X_node_side, X_ghost_vec, X_local_soln, side_dof_indices);
                 const bool qrule_needs_reinit = d_fe_data_managers[part]->updateSpreadQuadratureRule(
-                    qrule_face, d_spread_spec, side_elem.get(), X_node, patch_dx_min);
+                    qrule_face, d_spread_spec, side_elem.get(), X_node_side, patch_dx_min);
                 if (qrule_needs_reinit)
                 {
                     fe_face->attach_quadrature_rule(qrule_face.get());
@@ -1522,8 +1738,24 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
                 X_bdry.resize(X_bdry.size() + NDIM * n_qp);
                 for (unsigned int qp = 0; qp < n_qp; ++qp, ++qp_offset)
                 {
-                    const libMesh::Point& s_qp = q_point_face[qp];
+                    const int idx = NDIM * qp_offset;
                     interpolate(X_qp, qp, X_node, phi_face);
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        X_bdry[idx + i] = X_qp(i);
+                    }
+
+                    if (spread_surface_force)
+                    {
+                        interpolate(F, qp, F_node, phi_face);
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            T_bdry[idx + i] = F(i) * thickness_weight * JxW_face[qp];
+                        }
+                        continue;
+                    }
+
+                    const libMesh::Point& s_qp = q_point_face[qp];
                     jacobian(FF, qp, X_node, dphi_face);
                     const double J = std::abs(FF.det());
                     tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
@@ -1531,19 +1763,19 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (has_PK1_stress_fcn(d_PK1_stress_fcn_data[part][k]))
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            compute_PK1_stress(PP,
+                                               FF,
+                                               X_qp,
+                                               s_qp,
+                                               elem,
+                                               PK1_stress_fcn_data[k],
+                                               data_time,
+                                               d_PK1_stress_fcn_data[part][k]);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -1580,17 +1812,13 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
                         F += F_s * JxW_face[qp];
                     }
 
-                    const int idx = NDIM * qp_offset;
                     for (unsigned int i = 0; i < NDIM; ++i)
                     {
                         T_bdry[idx + i] = F(i);
                     }
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        X_bdry[idx + i] = X_qp(i);
-                    }
                 }
             }
+            if (elem_force_cost) (*elem_force_cost)[elem->id()] += MPI_Wtime() - elem_start_time;
         }
 
         if (qp_offset == 0) continue;
@@ -1618,10 +1846,16 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     }
     var_db->removePatchDataIndex(f_copy_data_idx);
 
+    if (spread_surface_force)
+    {
+        VecRestoreArray(F_local_vec, &F_local_soln);
+        VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
+    }
+
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
     return;
-} // spreadTransmissionForceDensity
+} // spreadBoundaryForceDensity
 
 void
 IBFEMethod::imposeJumpConditions(const int f_data_idx,
@@ -1637,6 +1871,7 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
     const MeshBase& mesh = equation_systems->get_mesh();
     const BoundaryInfo& boundary_info = *mesh.boundary_info;
     const unsigned int dim = mesh.mesh_dimension();
+    std::map<unsigned int, double>* const elem_force_cost = getElementForceCostData(part);
     TBOX_ASSERT(dim == NDIM);
 
     // Extract the FE systems and DOF maps, and setup the FE object.
@@ -1773,6 +2008,7 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
             Elem* const elem = patch_elems[e_idx];
             const bool touches_physical_bdry = has_physical_bdry(elem, boundary_info, dof_map);
             if (!touches_physical_bdry) continue;
+            const double elem_start_time = elem_force_cost ? MPI_Wtime() : 0.0;
 
             for (unsigned int d = 0; d < NDIM; ++d)
             {
@@ -1919,19 +2155,19 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (has_PK1_stress_fcn(d_PK1_stress_fcn_data[part][k]))
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            compute_PK1_stress(PP,
+                                               FF,
+                                               X_qp,
+                                               s_qp,
+                                               elem,
+                                               PK1_stress_fcn_data[k],
+                                               data_time,
+                                               d_PK1_stress_fcn_data[part][k]);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2006,6 +2242,7 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                     (*f_data)(i_s) += (n(axis) > 0.0 ? +1.0 : -1.0) * (C_p / dx[axis]);
                 }
             }
+            if (elem_force_cost) (*elem_force_cost)[elem->id()] += MPI_Wtime() - elem_start_time;
         }
     }
 
@@ -2118,6 +2355,9 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_quad_type = QGAUSS;
     d_quad_order = INVALID_ORDER;
     d_use_consistent_mass_matrix = true;
+    d_repartition_fe_mesh = false;
+    d_workload_force_cost_weight = 0.0;
+    d_workload_rebalance_interval = 0;
     d_do_log = false;
 
     // Initialize function data to NULL.
@@ -2126,6 +2366,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_lag_body_force_fcn_data.resize(d_num_parts);
     d_lag_surface_pressure_fcn_data.resize(d_num_parts);
     d_lag_surface_force_fcn_data.resize(d_num_parts);
+    d_surface_spreading_thickness.resize(d_num_parts, 0.0);
+    d_elem_force_cost.resize(d_num_parts);
     d_fcn_systems.resize(d_num_parts);
     d_body_fcn_systems.resize(d_num_parts);
     d_surface_fcn_systems.resize(d_num_parts);
@@ -2263,6 +2505,138 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     return;
 } // commonConstructor
 
+std::map<unsigned int, double>*
+IBFEMethod::getElementForceCostData(const unsigned int part)
+{
+    if (!d_load_balancer || d_workload_force_cost_weight <= 0.0) return NULL;
+    return &d_elem_force_cost[part];
+} // getElementForceCostData
+
+void
+IBFEMethod::updateForceCostWorkloadEstimates(const unsigned int part)
+{
+    std::map<unsigned int, double>* const elem_force_cost_ptr = getElementForceCostData(part);
+    if (!elem_force_cost_ptr) return;
+    std::map<unsigned int, double>& elem_force_cost = *elem_force_cost_ptr;
+
+    // Element costs are measured by the process that owns each element in the
+    // libMesh partitioning, which generally differs from the process that
+    // owns the Cartesian grid patches that the element intersects.  Gather
+    // the measured costs into a dense array indexed by element id so that
+    // each cost can be attributed by a process that owns one of those
+    // patches.
+    FEDataManager* const fe_data_manager = d_fe_data_managers[part];
+    EquationSystems* equation_systems = fe_data_manager->getEquationSystems();
+    const MeshBase& mesh = equation_systems->get_mesh();
+    const int max_elem_id = static_cast<int>(mesh.max_elem_id());
+    if (max_elem_id == 0)
+    {
+        elem_force_cost.clear();
+        return;
+    }
+    std::vector<double> cost_data(max_elem_id, 0.0);
+    for (std::map<unsigned int, double>::const_iterator it = elem_force_cost.begin(); it != elem_force_cost.end();
+         ++it)
+    {
+        if (it->second > 0.0 && static_cast<int>(it->first) < max_elem_id) cost_data[it->first] += it->second;
+    }
+    elem_force_cost.clear();
+    SAMRAI_MPI::sumReduction(&cost_data[0], max_elem_id);
+
+    // Normalize the costs so that an element of average cost contributes a
+    // workload equal to the weighting factor.
+    double total_cost = 0.0;
+    double num_measured_elems = 0.0;
+    for (int k = 0; k < max_elem_id; ++k)
+    {
+        if (cost_data[k] <= 0.0) continue;
+        total_cost += cost_data[k];
+        num_measured_elems += 1.0;
+    }
+    if (num_measured_elems == 0.0 || total_cost <= 0.0) return;
+    const double cost_scale = d_workload_force_cost_weight * num_measured_elems / total_cost;
+
+    // Each element is attributed to exactly one process: the lowest-ranked
+    // process that owns a patch intersecting the element.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int level_num = fe_data_manager->getLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const std::vector<std::vector<Elem*> >& active_patch_element_map = fe_data_manager->getActivePatchElementMap();
+    std::vector<int> elem_owner(max_elem_id, std::numeric_limits<int>::max());
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const std::vector<Elem*>& patch_elems = active_patch_element_map[local_patch_num];
+        for (size_t e_idx = 0; e_idx < patch_elems.size(); ++e_idx)
+        {
+            const unsigned int elem_id = patch_elems[e_idx]->id();
+            if (cost_data[elem_id] > 0.0) elem_owner[elem_id] = mpi_rank;
+        }
+    }
+    SAMRAI_MPI::minReduction(&elem_owner[0], max_elem_id);
+
+    // Attribute the cost of each element to the Cartesian grid cell nearest to
+    // its nodal centroid within the first local patch that the element
+    // intersects.
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
+    const DofMap& X_dof_map = X_system.get_dof_map();
+    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
+    PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(fe_data_manager->buildGhostedCoordsVector());
+    Vec X_global_vec = X_petsc_vec->vec();
+    Vec X_local_vec;
+    VecGhostGetLocalForm(X_global_vec, &X_local_vec);
+    const double* X_local_soln;
+    VecGetArrayRead(X_local_vec, &X_local_soln);
+    boost::multi_array<double, 2> X_node;
+    libMesh::Point X_centroid;
+    local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const std::vector<Elem*>& patch_elems = active_patch_element_map[local_patch_num];
+        const size_t num_active_patch_elems = patch_elems.size();
+        if (num_active_patch_elems == 0) continue;
+
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_idx);
+        for (size_t e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        {
+            Elem* const elem = patch_elems[e_idx];
+            const unsigned int elem_id = elem->id();
+            if (elem_owner[elem_id] != mpi_rank) continue;
+            const double cost = cost_data[elem_id];
+            cost_data[elem_id] = 0.0;
+            if (cost <= 0.0) continue;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_dof_map.dof_indices(elem, X_dof_indices[d], d);
+            }
+            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
+            const size_t n_nodes = X_dof_indices[0].size();
+            X_centroid.zero();
+            for (size_t k = 0; k < n_nodes; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_centroid(d) += X_node[k][d];
+                }
+            }
+            X_centroid /= static_cast<double>(n_nodes);
+            Index<NDIM> i = IndexUtilities::getCellIndex(X_centroid, grid_geom, ratio);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i(d) = std::max(patch_box.lower(d), std::min(patch_box.upper(d), i(d)));
+            }
+            (*workload_data)(i) += cost_scale * cost;
+        }
+    }
+    VecRestoreArrayRead(X_local_vec, &X_local_soln);
+    VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
+    return;
+} // updateForceCostWorkloadEstimates
+
 void
 IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
@@ -2295,6 +2669,18 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_interp_spec.point_density = db->getDouble("interp_point_density");
     else if (db->isDouble("IB_point_density"))
         d_interp_spec.point_density = db->getDouble("IB_point_density");
+    if (db->isBool("interp_use_strain_indicator"))
+        d_interp_spec.use_strain_indicator = db->getBool("interp_use_strain_indicator");
+    else if (db->isBool("IB_use_strain_indicator"))
+        d_interp_spec.use_strain_indicator = db->getBool("IB_use_strain_indicator");
+    if (db->isDouble("interp_min_point_density"))
+        d_interp_spec.min_point_density = db->getDouble("interp_min_point_density");
+    else if (db->isDouble("IB_min_point_density"))
+        d_interp_spec.min_point_density = db->getDouble("IB_min_point_density");
+    if (db->isDouble("interp_strain_threshold"))
+        d_interp_spec.strain_threshold = db->getDouble("interp_strain_threshold");
+    else if (db->isDouble("IB_strain_threshold"))
+        d_interp_spec.strain_threshold = db->getDouble("IB_strain_threshold");
 
     if (db->isBool("interp_use_consistent_mass_matrix"))
         d_interp_spec.use_consistent_mass_matrix = db->getBool("interp_use_consistent_mass_matrix");
@@ -2328,6 +2714,31 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_spread_spec.point_density = db->getDouble("spread_point_density");
     else if (db->isDouble("IB_point_density"))
         d_spread_spec.point_density = db->getDouble("IB_point_density");
+    if (db->isBool("spread_use_strain_indicator"))
+        d_spread_spec.use_strain_indicator = db->getBool("spread_use_strain_indicator");
+    else if (db->isBool("IB_use_strain_indicator"))
+        d_spread_spec.use_strain_indicator = db->getBool("IB_use_strain_indicator");
+    if (db->isDouble("spread_min_point_density"))
+        d_spread_spec.min_point_density = db->getDouble("spread_min_point_density");
+    else if (db->isDouble("IB_min_point_density"))
+        d_spread_spec.min_point_density = db->getDouble("IB_min_point_density");
+    if (db->isDouble("spread_strain_threshold"))
+        d_spread_spec.strain_threshold = db->getDouble("spread_strain_threshold");
+    else if (db->isDouble("IB_strain_threshold"))
+        d_spread_spec.strain_threshold = db->getDouble("IB_strain_threshold");
+
+    if (d_interp_spec.use_strain_indicator && d_interp_spec.min_point_density > d_interp_spec.point_density)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  interpolation min_point_density = " << d_interp_spec.min_point_density
+                                 << " exceeds point_density = " << d_interp_spec.point_density << std::endl);
+    }
+    if (d_spread_spec.use_strain_indicator && d_spread_spec.min_point_density > d_spread_spec.point_density)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  spreading min_point_density = " << d_spread_spec.min_point_density
+                                 << " exceeds point_density = " << d_spread_spec.point_density << std::endl);
+    }
 
     // Force computation settings.
     if (db->isBool("split_forces")) d_split_forces = db->getBool("split_forces");
@@ -2336,6 +2747,19 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->isString("quad_order")) d_quad_order = Utility::string_to_enum<Order>(db->getString("quad_order"));
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("repartition_fe_mesh")) d_repartition_fe_mesh = db->getBool("repartition_fe_mesh");
+    if (db->isDouble("surface_spreading_thickness"))
+    {
+        std::fill(d_surface_spreading_thickness.begin(),
+                  d_surface_spreading_thickness.end(),
+                  db->getDouble("surface_spreading_thickness"));
+    }
+
+    // Load balancing settings.
+    if (db->isDouble("workload_force_cost_weight"))
+        d_workload_force_cost_weight = db->getDouble("workload_force_cost_weight");
+    if (db->isInteger("workload_rebalance_interval"))
+        d_workload_rebalance_interval = db->getInteger("workload_rebalance_interval");
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -547,6 +547,7 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     if (initial_time) return true;
+    if (d_ib_method_ops->requiresRegrid(d_integrator_step)) return true;
     if (d_regrid_cfl_interval > 0.0)
     {
         return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
@@ -170,6 +170,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
     d_do_log = false;
+    d_num_lagrangian_substeps.resize(1, 1);
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -296,6 +297,33 @@ IBMethod::getIBInstrumentPanel() const
     return d_instrument_panel;
 } // getIBInstrumentPanel
 
+void
+IBMethod::setNumberOfLagrangianSubsteps(const int num_substeps, const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_substeps >= 1);
+#endif
+    if (level_number < 0)
+    {
+        d_num_lagrangian_substeps.assign(d_num_lagrangian_substeps.size(), num_substeps);
+        return;
+    }
+    if (static_cast<int>(d_num_lagrangian_substeps.size()) <= level_number)
+    {
+        d_num_lagrangian_substeps.resize(level_number + 1, d_num_lagrangian_substeps.back());
+    }
+    d_num_lagrangian_substeps[level_number] = num_substeps;
+    return;
+} // setNumberOfLagrangianSubsteps
+
+int
+IBMethod::getNumberOfLagrangianSubsteps(const int level_number) const
+{
+    if (level_number < static_cast<int>(d_num_lagrangian_substeps.size()))
+        return d_num_lagrangian_substeps[level_number];
+    return d_num_lagrangian_substeps.back();
+} // getNumberOfLagrangianSubsteps
+
 void
 IBMethod::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_writer)
 {
@@ -428,6 +456,20 @@ IBMethod::preprocessIntegrateData(double current_time, double new_time, int /*nu
     d_X_new_needs_ghost_fill = true;
     d_X_LE_new_needs_ghost_fill = true;
 
+    // Start filling the ghost values of the current positions, which are
+    // needed when spreading at the beginning of the time step.
+    //
+    // NOTE: The fill is completed only when the ghost values are needed, so
+    // that the communication overlaps with the Eulerian work that is performed
+    // in the meantime.
+    if (d_X_current_needs_ghost_fill)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            d_X_current_data[ln]->beginGhostUpdate();
+        }
+    }
     return;
 } // preprocessIntegrateData
 
@@ -455,6 +497,17 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
         }
     }
 
+    // Report the number of Lagrangian ghost updates that were performed or
+    // skipped during the time step.
+    if (d_do_log)
+    {
+        unsigned int num_ghost_updates_performed, num_ghost_updates_skipped;
+        LData::getGhostUpdateCounts(num_ghost_updates_performed, num_ghost_updates_skipped);
+        plog << d_object_name << "::postprocessIntegrateData(): Lagrangian ghost updates performed: "
+             << num_ghost_updates_performed << ", skipped: " << num_ghost_updates_skipped << "\n";
+    }
+    LData::resetGhostUpdateCounts();
+
     // Reset time-dependent Lagrangian data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -492,6 +545,8 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_F_new_data.clear();
     d_F_half_data.clear();
     d_F_jac_data.clear();
+    d_X_substep_data.clear();
+    d_F_substep_data.clear();
 
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
@@ -857,11 +912,67 @@ IBMethod::computeLagrangianForce(const double data_time)
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
         ierr = VecSet((*F_data)[ln]->getVec(), 0.0);
         IBTK_CHKERRQ(ierr);
-        if (d_ib_force_fcn)
+        const int num_substeps = getNumberOfLagrangianSubsteps(ln);
+        const double dt = d_new_time - d_current_time;
+        if (d_ib_force_fcn && (num_substeps == 1 || !(dt > 0.0)))
         {
             d_ib_force_fcn->computeLagrangianForce(
                 (*F_data)[ln], (*X_data)[ln], (*U_data)[ln], d_hierarchy, ln, data_time, d_l_data_manager);
         }
+        else if (d_ib_force_fcn)
+        {
+            // Average the force over substeps in which the structure is
+            // advanced from its position at the beginning of the time step
+            // with the frozen velocity interpolated at data_time,
+            // X_{k+1} = X_k + (dt/n) U.  The force is evaluated at each
+            // substep position X_k and time t_k = current_time + k dt/n,
+            // k = 0, ..., n-1, so that the substeps do not extend past
+            // new_time.
+            if (static_cast<int>(d_X_substep_data.size()) <= ln) d_X_substep_data.resize(ln + 1);
+            if (static_cast<int>(d_F_substep_data.size()) <= ln) d_F_substep_data.resize(ln + 1);
+            if (!d_X_substep_data[ln]) d_X_substep_data[ln] = d_l_data_manager->createLData("X_substep", ln, NDIM);
+            if (!d_F_substep_data[ln]) d_F_substep_data[ln] = d_l_data_manager->createLData("F_substep", ln, NDIM);
+            Vec X_vec = d_X_current_data[ln]->getVec();
+            Vec U_vec = (*U_data)[ln]->getVec();
+            Vec F_vec = (*F_data)[ln]->getVec();
+            Vec X_substep_vec = d_X_substep_data[ln]->getVec();
+            Vec F_substep_vec = d_F_substep_data[ln]->getVec();
+            const double dt_substep = dt / static_cast<double>(num_substeps);
+            ierr = VecCopy(X_vec, X_substep_vec);
+            IBTK_CHKERRQ(ierr);
+            for (int k = 0; k < num_substeps; ++k)
+            {
+                if (k > 0)
+                {
+                    ierr = VecAXPY(X_substep_vec, dt_substep, U_vec);
+                    IBTK_CHKERRQ(ierr);
+                }
+                d_X_substep_data[ln]->beginGhostUpdate();
+                d_X_substep_data[ln]->endGhostUpdate();
+                ierr = VecSet(F_substep_vec, 0.0);
+                IBTK_CHKERRQ(ierr);
+                const double substep_time =
+                    std::min(d_current_time + static_cast<double>(k) * dt_substep, d_new_time);
+                d_ib_force_fcn->computeLagrangianForce(d_F_substep_data[ln],
+                                                       d_X_substep_data[ln],
+                                                       (*U_data)[ln],
+                                                       d_hierarchy,
+                                                       ln,
+                                                       substep_time,
+                                                       d_l_data_manager);
+                ierr = VecAXPY(F_vec, 1.0 / static_cast<double>(num_substeps), F_substep_vec);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+
+        // Start filling the ghost values of the force, which are needed when
+        // spreading.  The fill is completed when the force is spread, so that
+        // the communication overlaps with the force computation on the
+        // remaining levels and with the Eulerian work that precedes spreading.
+        //
+        // NOTE: If the force is modified before it is spread (e.g., at anchor
+        // points), the fill is repeated when the force is spread.
+        (*F_data)[ln]->beginGhostUpdate();
     }
     *F_needs_ghost_fill = true;
     return;
@@ -1532,6 +1643,9 @@ void
 IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                 Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
+    // NOTE: The nonlocal data fills that are started by the data manager are
+    // completed on demand.  The position data are only read below, so that
+    // their ghost values remain current.
     d_l_data_manager->endDataRedistribution();
 
     // Look up the re-distributed Lagrangian position data.
@@ -1578,7 +1692,7 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                 }
             }
         }
-        X_data[ln]->restoreArrays();
+        X_data[ln]->restoreArrays(/*data_modified*/ false);
     }
 
     // Indicate that the force and source strategies need to be re-initialized.
@@ -1920,6 +2034,9 @@ IBMethod::resetAnchorPointValues(std::vector<Pointer<LData> > U_data, const int
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        // NOTE: Levels without local anchor points are not accessed, so that
+        // any ghost values that are current remain so.
+        if (d_anchor_point_local_idxs[ln].empty()) continue;
         const int depth = U_data[ln]->getDepth();
 #if !defined(NDEBUG)
         TBOX_ASSERT(depth == NDIM);
@@ -2069,6 +2186,25 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("lagrangian_substeps"))
+    {
+        const int n_levels = db->getArraySize("lagrangian_substeps");
+        if (n_levels < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  lagrangian_substeps must contain at least one entry" << std::endl);
+        }
+        d_num_lagrangian_substeps.resize(n_levels);
+        db->getIntegerArray("lagrangian_substeps", &d_num_lagrangian_substeps[0], n_levels);
+        for (int ln = 0; ln < n_levels; ++ln)
+        {
+            if (d_num_lagrangian_substeps[ln] < 1)
+            {
+                TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                         << "  lagrangian_substeps must be positive on all levels" << std::endl);
+            }
+        }
+    }
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -255,6 +255,12 @@ IBStrategy::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     return;
 } // updateWorkloadEstimates
 
+bool
+IBStrategy::requiresRegrid(int /*integrator_step*/) const
+{
+    return false;
+} // requiresRegrid
+
 void IBStrategy::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -377,6 +377,18 @@ IBStrategySet::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // updateWorkloadEstimates
 
+bool
+IBStrategySet::requiresRegrid(const int integrator_step) const
+{
+    bool requires_regrid = false;
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        requires_regrid = requires_regrid || (*cit)->requiresRegrid(integrator_step);
+    }
+    return requires_regrid;
+} // requiresRegrid
+
 void
 IBStrategySet::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                        Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
@@ -423,8 +423,19 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     d_petsc_x = x;
     VecCopy(b, d_petsc_b);
 
+    // Form the initial guess from the previous solutions.  Each application
+    // of the mobility matrix requires a Stokes solve, so this is worthwhile
+    // only when it saves more than one Krylov iteration per solve.
+    const bool use_recycle_space = d_recycle_space.getMaxSize() > 0;
+    if (use_recycle_space)
+    {
+        d_recycle_space.formInitialGuess(d_petsc_mat, d_petsc_x, d_petsc_b, d_initial_guess_nonzero);
+        KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+    }
+
     // Solve the system using a PETSc KSP object.
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
+    if (use_recycle_space) d_recycle_space.update(d_petsc_mat, d_petsc_x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
 
@@ -433,6 +444,12 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     KSPGetConvergedReason(d_petsc_ksp, &reason);
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
+    if (d_enable_logging && use_recycle_space)
+    {
+        plog << d_object_name << "::solveSystem(): recycle space size = " << d_recycle_space.getSize()
+             << ", initial residual norm = " << d_recycle_space.getInitialResidualNorm()
+             << ", projected initial residual norm = " << d_recycle_space.getProjectedResidualNorm() << "\n";
+    }
 
     // Deallocate the solver, when necessary.
     d_petsc_x = NULL;
@@ -540,6 +557,9 @@ KrylovMobilitySolver::deallocateSolverState()
     d_petsc_x = NULL;
     d_petsc_b = NULL;
 
+    // Discard the recycled vectors.
+    d_recycle_space.reset();
+
     // Destroy the KSP solver.
     destroyKSP();
 
@@ -567,6 +587,8 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("pc_type")) d_pc_type = input_db->getString("pc_type");
     if (input_db->keyExists("initial_guess_nonzero"))
         d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+    if (input_db->keyExists("recycle_space_size"))
+        d_recycle_space.setMaxSize(input_db->getInteger("recycle_space_size"));
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
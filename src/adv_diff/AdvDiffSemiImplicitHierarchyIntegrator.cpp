@@ -73,6 +73,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/FACPreconditioner.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
 #include "tbox/Database.h"
@@ -935,6 +936,15 @@ AdvDiffSemiImplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
     if (d_enable_logging)
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
 
+    // Report the cycle statistics of any FAC solvers or preconditioners.
+    if (d_enable_logging)
+    {
+        for (unsigned int k = 0; k < d_helmholtz_solvers.size(); ++k)
+        {
+            FACPreconditioner::logCycleStatistics(d_helmholtz_solvers[k], plog);
+        }
+    }
+
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
@@ -93,6 +93,7 @@
 #include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/FACPreconditioner.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
@@ -1491,6 +1492,13 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
             plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
     }
 
+    // Report the cycle statistics of any FAC solvers or preconditioners.
+    if (d_enable_logging)
+    {
+        FACPreconditioner::logCycleStatistics(d_velocity_solver, plog);
+        FACPreconditioner::logCycleStatistics(d_pressure_solver, plog);
+    }
+
     // Compute max |Omega|_2.
     if (d_using_vorticity_tagging)
     {
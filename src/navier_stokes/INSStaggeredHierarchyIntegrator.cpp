@@ -109,6 +109,7 @@
 #include "ibtk/CartSideDoubleSpecializedConstantRefine.h"
 #include "ibtk/CartSideDoubleSpecializedLinearRefine.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
+#include "ibtk/FACPreconditioner.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
@@ -126,6 +127,8 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -365,6 +368,19 @@ static const std::string DATA_COARSEN_TYPE = "CUBIC_COARSEN";
 // interface ghost cells.
 static const bool CONSISTENT_TYPE_2_BDRY = false;
 
+// Timers.
+static Timer* t_setup_solvers;
+static Timer* t_solve_stokes_system;
+
+// Determine whether a solver coefficient is within the specified relative
+// tolerance of the value used when the solver was last set up.
+inline bool
+solver_coef_is_reusable(const double coef, const double setup_coef, const double rel_tol)
+{
+    if (MathUtilities<double>::equalEps(coef, setup_coef)) return true;
+    return std::abs(coef - setup_coef) <= rel_tol * std::abs(setup_coef);
+} // solver_coef_is_reusable
+
 // Copy data from a side-centered variable to a face-centered variable.
 void
 copy_side_to_face(const int U_fc_idx, const int U_sc_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
@@ -530,6 +546,33 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether the FFT-based level solvers are used by default
+    // for the velocity and pressure subproblems.
+    d_use_fft_subdomain_solvers = false;
+    if (input_db->keyExists("use_fft_subdomain_solvers"))
+        d_use_fft_subdomain_solvers = input_db->getBool("use_fft_subdomain_solvers");
+
+    // Relative change in the velocity reaction coefficient that is permitted
+    // before the solvers are set up again.  By default, any change in the
+    // coefficients triggers a new setup.  Solver components that are built
+    // from C at setup time (e.g., coarse-level and PETSc level solver
+    // matrices, box relaxation inverses, and Chebyshev eigenvalue estimates)
+    // keep using the stale value until the next setup.
+    d_solver_setup_reuse_rel_tol = 0.0;
+    if (input_db->keyExists("solver_setup_reuse_rel_tol"))
+        d_solver_setup_reuse_rel_tol = input_db->getDouble("solver_setup_reuse_rel_tol");
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_solver_setup_reuse_rel_tol >= 0.0);
+#endif
+    d_velocity_solver_setup_C = 0.0;
+    d_velocity_solver_setup_D = 0.0;
+    d_pressure_solver_setup_D = 0.0;
+    d_stokes_solver_setup_C = 0.0;
+    d_stokes_solver_setup_D = 0.0;
+    d_stokes_solver_setup_P_D = 0.0;
+    d_solver_setup_time = 0.0;
+    d_solver_setup_traction_bc_type = d_traction_bc_type;
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -566,6 +609,12 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     d_indicator_var = new SideVariable<NDIM, double>(d_object_name + "::indicator");
     d_F_div_var = new SideVariable<NDIM, double>(d_object_name + "::F_div");
     d_EE_var = new CellVariable<NDIM, double>(d_object_name + "::EE", NDIM * NDIM);
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_setup_solvers = TimerManager::getManager()->getTimer(
+                      "IBAMR::INSStaggeredHierarchyIntegrator::setupSolvers()");
+                  t_solve_stokes_system = TimerManager::getManager()->getTimer(
+                      "IBAMR::INSStaggeredHierarchyIntegrator::solveStokesSystem()"););
     return;
 } // INSStaggeredHierarchyIntegrator
 
@@ -700,6 +749,30 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
     d_gridding_alg = gridding_alg;
 
     // Setup solvers.
+    if (d_use_fft_subdomain_solvers)
+    {
+        // The FFT-based level solvers solve the subdomain problems directly,
+        // so they are used without a Krylov wrapper.  The solvers check the
+        // domain geometry when they are initialized.
+        if (gridding_alg->getMaxLevels() != 1)
+        {
+            TBOX_ERROR(d_object_name << "::initializeHierarchyIntegrator():\n"
+                                     << "  use_fft_subdomain_solvers requires a single-level grid\n");
+        }
+        if (d_velocity_solver_type == SCPoissonSolverManager::UNDEFINED)
+        {
+            d_velocity_solver_type = SCPoissonSolverManager::FFT_LEVEL_SOLVER;
+        }
+        if (d_pressure_solver_type == CCPoissonSolverManager::UNDEFINED)
+        {
+            d_pressure_solver_type = CCPoissonSolverManager::FFT_LEVEL_SOLVER;
+        }
+        if (d_regrid_projection_precond_type == CCPoissonSolverManager::UNDEFINED)
+        {
+            d_regrid_projection_precond_type = CCPoissonSolverManager::FFT_LEVEL_SOLVER;
+        }
+    }
+
     if (d_stokes_solver_type == StaggeredStokesSolverManager::UNDEFINED)
     {
         d_stokes_solver_type = StaggeredStokesSolverManager::PETSC_KRYLOV_SOLVER;
@@ -1282,7 +1355,18 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
     // Solve for u(n+1), p(n+1/2).
+    IBAMR_TIMER_START(t_solve_stokes_system);
+    const double solve_start_time = d_enable_logging ? MPI_Wtime() : 0.0;
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    IBAMR_TIMER_STOP(t_solve_stokes_system);
+    if (d_enable_logging)
+    {
+        // The setup time is reported by the first cycle after the solvers are
+        // (re)initialized and is zero whenever the previous setup was reused.
+        plog << d_object_name << "::integrateHierarchy(): solver setup time = " << d_solver_setup_time
+             << ", stokes solve time = " << MPI_Wtime() - solve_start_time << "\n";
+        d_solver_setup_time = 0.0;
+    }
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -1386,6 +1470,14 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
             plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
     }
 
+    // Report the cycle statistics of any FAC solvers or preconditioners.
+    if (d_enable_logging)
+    {
+        FACPreconditioner::logCycleStatistics(d_stokes_solver, plog);
+        FACPreconditioner::logCycleStatistics(d_velocity_solver, plog);
+        FACPreconditioner::logCycleStatistics(d_pressure_solver, plog);
+    }
+
     // Compute max |Omega|_2.
     if (d_using_vorticity_tagging)
     {
@@ -2278,7 +2370,6 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
 {
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     const double dt = new_time - current_time;
     const double half_time = current_time + 0.5 * dt;
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
@@ -2309,13 +2400,36 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
     // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
-    const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    // boundary conditions or the problem coefficients change.  Hierarchy
+    // changes are flagged when the hierarchy configuration is reset.  When only
+    // the time step size changes, the new coefficients are passed to the
+    // existing solvers below, and their setup is reused so long as the change
+    // in the reaction coefficient is within the specified tolerance.
+    if (d_bc_coefs != d_solver_setup_bc_coefs || d_traction_bc_type != d_solver_setup_traction_bc_type)
+    {
+        d_velocity_solver_needs_init = true;
+        d_pressure_solver_needs_init = true;
+        d_stokes_solver_needs_init = true;
+    }
+    if (!solver_coef_is_reusable(
+            U_problem_coefs.getCConstant(), d_velocity_solver_setup_C, d_solver_setup_reuse_rel_tol) ||
+        !solver_coef_is_reusable(U_problem_coefs.getDConstant(), d_velocity_solver_setup_D, 0.0))
     {
         d_velocity_solver_needs_init = true;
+    }
+    if (!solver_coef_is_reusable(P_problem_coefs.getDConstant(), d_pressure_solver_setup_D, 0.0))
+    {
+        d_pressure_solver_needs_init = true;
+    }
+    if (!solver_coef_is_reusable(
+            U_problem_coefs.getCConstant(), d_stokes_solver_setup_C, d_solver_setup_reuse_rel_tol) ||
+        !solver_coef_is_reusable(U_problem_coefs.getDConstant(), d_stokes_solver_setup_D, 0.0) ||
+        !solver_coef_is_reusable(P_problem_coefs.getDConstant(), d_stokes_solver_setup_P_D, 0.0))
+    {
         d_stokes_solver_needs_init = true;
     }
+    d_solver_setup_bc_coefs = d_bc_coefs;
+    d_solver_setup_traction_bc_type = d_traction_bc_type;
 
     // Setup solver vectors.
     const bool has_velocity_nullspace = d_normalize_velocity && MathUtilities<double>::equalEps(rho, 0.0);
@@ -2463,7 +2577,13 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_velocity_solver->setInitialGuessNonzero(false);
                 if (has_velocity_nullspace) p_velocity_solver->setNullspace(false, d_U_nul_vecs);
             }
+            IBAMR_TIMER_START(t_setup_solvers);
+            const double setup_start_time = d_enable_logging ? MPI_Wtime() : 0.0;
             d_velocity_solver->initializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
+            if (d_enable_logging) d_solver_setup_time += MPI_Wtime() - setup_start_time;
+            IBAMR_TIMER_STOP(t_setup_solvers);
+            d_velocity_solver_setup_C = U_problem_coefs.getCConstant();
+            d_velocity_solver_setup_D = U_problem_coefs.getDConstant();
             d_velocity_solver_needs_init = false;
         }
     }
@@ -2486,7 +2606,12 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_pressure_solver->setInitialGuessNonzero(false);
                 if (has_pressure_nullspace) p_pressure_solver->setNullspace(true);
             }
+            IBAMR_TIMER_START(t_setup_solvers);
+            const double setup_start_time = d_enable_logging ? MPI_Wtime() : 0.0;
             d_pressure_solver->initializeSolverState(*d_P_scratch_vec, *d_P_rhs_vec);
+            if (d_enable_logging) d_solver_setup_time += MPI_Wtime() - setup_start_time;
+            IBAMR_TIMER_STOP(t_setup_solvers);
+            d_pressure_solver_setup_D = P_problem_coefs.getDConstant();
             d_pressure_solver_needs_init = false;
         }
     }
@@ -2550,7 +2675,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             if (has_velocity_nullspace || has_pressure_nullspace)
                 p_stokes_linear_solver->setNullspace(false, d_nul_vecs);
         }
+        IBAMR_TIMER_START(t_setup_solvers);
+        const double setup_start_time = d_enable_logging ? MPI_Wtime() : 0.0;
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
+        if (d_enable_logging) d_solver_setup_time += MPI_Wtime() - setup_start_time;
+        IBAMR_TIMER_STOP(t_setup_solvers);
+        d_stokes_solver_setup_C = U_problem_coefs.getCConstant();
+        d_stokes_solver_setup_D = U_problem_coefs.getDConstant();
+        d_stokes_solver_setup_P_D = P_problem_coefs.getDConstant();
         d_stokes_solver_needs_init = false;
     }
     return;
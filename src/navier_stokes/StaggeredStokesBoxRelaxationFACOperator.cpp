@@ -33,7 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
-#include <limits>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -64,11 +64,8 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/IBTK_CHKERRQ.h"
-#include "petscksp.h"
 #include "petscmat.h"
-#include "petscpc.h"
 #include "petscsys.h"
-#include "petscvec.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -85,6 +82,19 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
+// Number of unknowns in each (single-cell) box system.
+static const int BOX_SIZE = 2 * NDIM + 1;
+
+// Number of colors used by the colored multiplicative smoother.  A box update
+// writes the unknowns of one cell and reads the normal velocity one face beyond
+// the cell, so boxes must be at least three cells apart in each direction for
+// the updates of boxes of the same color to be independent.
+static const int NUM_COLORS = NDIM == 2 ? 9 : 27;
+
+// Maximum number of boxes of the same color whose systems are solved together
+// by the colored multiplicative smoother.
+static const int BOX_BATCH_SIZE = 32;
+
 inline int
 compute_side_index(const Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
 {
@@ -299,149 +309,170 @@ buildBoxOperator(Mat& A,
 } // buildBoxOperator
 
 void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
+computeBoxInverse(std::vector<double>& A_inv, Mat& A)
 {
     int ierr;
 
-    const double D = U_problem_coefs.getDConstant();
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Extract the (small) box operator as a dense matrix.
+    int size;
+    ierr = MatGetSize(A, &size, NULL);
+    IBTK_CHKERRQ(ierr);
+    TBOX_ASSERT(size == BOX_SIZE);
+    std::vector<int> idxs(size);
+    for (int k = 0; k < size; ++k) idxs[k] = k;
+    std::vector<double> A_dense(size * size);
+    ierr = MatGetValues(A, size, &idxs[0], size, &idxs[0], &A_dense[0]);
+    IBTK_CHKERRQ(ierr);
+
+    // Compute the inverse by Gauss-Jordan elimination with partial pivoting.
+    // Pivoting is required because the pressure-pressure block of the box
+    // operator is zero.
+    A_inv.assign(size * size, 0.0);
+    for (int k = 0; k < size; ++k) A_inv[k * size + k] = 1.0;
+    for (int k = 0; k < size; ++k)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        int pivot = k;
+        for (int i = k + 1; i < size; ++i)
         {
-            Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const Index<NDIM> u_left = i - shift;
-                const Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-                if (!side_box.contains(u_rght))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-
-            Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const Index<NDIM> p_left = i - shift;
-            const Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
+            if (std::abs(A_dense[i * size + k]) > std::abs(A_dense[pivot * size + k])) pivot = i;
+        }
+        if (A_dense[pivot * size + k] == 0.0)
+        {
+            TBOX_ERROR("StaggeredStokesBoxRelaxationFACOperator::computeBoxInverse():\n"
+                       << "  box operator is singular" << std::endl);
+        }
+        if (pivot != k)
+        {
+            for (int j = 0; j < size; ++j)
             {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                std::swap(A_dense[k * size + j], A_dense[pivot * size + j]);
+                std::swap(A_inv[k * size + j], A_inv[pivot * size + j]);
             }
-            if (!box.contains(p_rght))
+        }
+        const double pivot_inv = 1.0 / A_dense[k * size + k];
+        for (int j = 0; j < size; ++j)
+        {
+            A_dense[k * size + j] *= pivot_inv;
+            A_inv[k * size + j] *= pivot_inv;
+        }
+        for (int i = 0; i < size; ++i)
+        {
+            if (i == k) continue;
+            const double factor = A_dense[i * size + k];
+            if (factor == 0.0) continue;
+            for (int j = 0; j < size; ++j)
             {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                A_dense[i * size + j] -= factor * A_dense[k * size + j];
+                A_inv[i * size + j] -= factor * A_inv[k * size + j];
             }
         }
     }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
     return;
-} // modifyRhsForBcs
+} // computeBoxInverse
 
 inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
+smoothBoxes(SideData<NDIM, double>& U_error_data,
+            CellData<NDIM, double>& P_error_data,
+            const SideData<NDIM, double>& U_residual_data,
+            const CellData<NDIM, double>& P_residual_data,
+            const double* const A_inv,
+            const double D,
+            const double* const dx,
+            const Index<NDIM>& i_first,
+            const int num_boxes,
+            const int box_stride)
 {
-    int ierr;
+    static const double omega = 0.65;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_boxes <= BOX_BATCH_SIZE);
+#endif
 
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Setup the right-hand sides of the single-cell box systems centered at
+    // i_first + m*box_stride*e_0, m = 0, ..., num_boxes-1.  The unknowns are
+    // ordered as (u_0 lower, u_0 upper, ..., u_{NDIM-1} upper, p), and values
+    // outside each box are moved to the right-hand side using the current error
+    // values.  The right-hand sides are stored so that the values of each
+    // unknown are contiguous over the batch of boxes.
+    double r[BOX_SIZE * BOX_BATCH_SIZE], e[BOX_SIZE * BOX_BATCH_SIZE];
+    Index<NDIM> i = i_first;
+    for (int m = 0; m < num_boxes; ++m, i(0) += box_stride)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            Index<NDIM> shift_axis(0);
+            shift_axis(axis) = 1;
+            for (int upper = 0; upper <= 1; ++upper)
+            {
+                const Index<NDIM> i_s = upper ? i + shift_axis : i;
+                double rhs = U_residual_data(SideIndex<NDIM>(i_s, axis, SideIndex<NDIM>::Lower));
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    Index<NDIM> shift(0);
+                    shift(d) = 1;
+                    const double fac = D / (dx[d] * dx[d]);
+                    if (d != axis || !upper)
+                    {
+                        rhs += fac * U_error_data(SideIndex<NDIM>(i_s - shift, axis, SideIndex<NDIM>::Lower));
+                    }
+                    if (d != axis || upper)
+                    {
+                        rhs += fac * U_error_data(SideIndex<NDIM>(i_s + shift, axis, SideIndex<NDIM>::Lower));
+                    }
+                }
+                if (upper)
+                {
+                    rhs -= P_error_data(i + shift_axis) / dx[axis];
+                }
+                else
+                {
+                    rhs += P_error_data(i - shift_axis) / dx[axis];
+                }
+                r[(2 * axis + upper) * BOX_BATCH_SIZE + m] = rhs;
+            }
         }
+        r[2 * NDIM * BOX_BATCH_SIZE + m] = P_residual_data(i);
     }
 
-    for (Box<NDIM>::Iterator b(box); b; b++)
+    // Apply the precomputed dense inverse to the batch of right-hand sides.
+    // The innermost loops run over the boxes of the batch with unit stride, so
+    // that they may be vectorized.
+    for (int k = 0; k < BOX_SIZE; ++k)
     {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // copyToVec
-
-inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        double* const e_k = &e[k * BOX_BATCH_SIZE];
+        for (int m = 0; m < num_boxes; ++m)
         {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            e_k[m] = 0.0;
+        }
+        for (int l = 0; l < BOX_SIZE; ++l)
+        {
+            const double A_inv_kl = A_inv[k * BOX_SIZE + l];
+            const double* const r_l = &r[l * BOX_BATCH_SIZE];
+            for (int m = 0; m < num_boxes; ++m)
+            {
+                e_k[m] += A_inv_kl * r_l[m];
+            }
         }
     }
 
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
+    // Update the error using under-relaxation.
+    i = i_first;
+    for (int m = 0; m < num_boxes; ++m, i(0) += box_stride)
     {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            Index<NDIM> shift_axis(0);
+            shift_axis(axis) = 1;
+            const SideIndex<NDIM> s_lower(i, axis, SideIndex<NDIM>::Lower);
+            const SideIndex<NDIM> s_upper(i + shift_axis, axis, SideIndex<NDIM>::Lower);
+            U_error_data(s_lower) =
+                (1.0 - omega) * U_error_data(s_lower) + omega * e[(2 * axis) * BOX_BATCH_SIZE + m];
+            U_error_data(s_upper) =
+                (1.0 - omega) * U_error_data(s_upper) + omega * e[(2 * axis + 1) * BOX_BATCH_SIZE + m];
+        }
+        P_error_data(i) = (1.0 - omega) * P_error_data(i) + omega * e[2 * NDIM * BOX_BATCH_SIZE + m];
     }
     return;
-} // copyFromVec
+} // smoothBoxes
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -451,10 +482,7 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const Pointer<Database> input_db,
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix),
-      d_box_op(),
-      d_box_e(),
-      d_box_r(),
-      d_box_ksp(),
+      d_box_inv(),
       d_patch_side_bc_box_overlap(),
       d_patch_cell_bc_box_overlap()
 {
@@ -478,7 +506,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -591,9 +618,9 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
+        const double* const A_inv = &d_box_inv[level_num][0];
+        const double D = d_U_problem_coefs.getDConstant();
+        const bool use_colored_sweeps = d_smoother_type == "COLORED_MULTIPLICATIVE";
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -618,16 +645,61 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (use_colored_sweeps)
             {
-                const Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                for (int color = 0; color < NUM_COLORS; ++color)
+                {
+                    // Visit only the cells of the current color by striding
+                    // through the patch box from a color-dependent offset.
+                    // Cells of the same color along each row are independent
+                    // and are updated in batches.
+                    Index<NDIM> i_start;
+                    for (unsigned int d = 0, c = color; d < NDIM; ++d, c /= 3)
+                    {
+                        const int lower = patch_box.lower()(d);
+                        i_start(d) = lower + ((static_cast<int>(c % 3) - lower) % 3 + 3) % 3;
+                    }
+                    Index<NDIM> i = i_start;
+#if (NDIM == 3)
+                    for (i(2) = i_start(2); i(2) <= patch_box.upper()(2); i(2) += 3)
+#endif
+                    {
+                        for (i(1) = i_start(1); i(1) <= patch_box.upper()(1); i(1) += 3)
+                        {
+                            for (i(0) = i_start(0); i(0) <= patch_box.upper()(0); i(0) += 3 * BOX_BATCH_SIZE)
+                            {
+                                const int num_boxes =
+                                    std::min(BOX_BATCH_SIZE, (patch_box.upper()(0) - i(0)) / 3 + 1);
+                                smoothBoxes(*U_error_data,
+                                            *P_error_data,
+                                            *U_residual_data,
+                                            *P_residual_data,
+                                            A_inv,
+                                            D,
+                                            dx,
+                                            i,
+                                            num_boxes,
+                                            /*box_stride*/ 3);
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    smoothBoxes(*U_error_data,
+                                *P_error_data,
+                                *U_residual_data,
+                                *P_residual_data,
+                                A_inv,
+                                D,
+                                dx,
+                                b(),
+                                /*num_boxes*/ 1,
+                                /*box_stride*/ 1);
+                }
             }
         }
     }
@@ -648,10 +720,11 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
+    //
+    // NOTE: Boundary conditions are imposed through ghost cell values, and so
+    // all boxes on a level share the same operator.  We precompute its dense
+    // inverse once per level.
+    d_box_inv.resize(d_finest_ln + 1);
     const Box<NDIM> box(Index<NDIM>(0), Index<NDIM>(0));
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
@@ -663,26 +736,10 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
+        Mat box_op;
+        buildBoxOperator(box_op, d_U_problem_coefs, box, box, dx);
+        computeBoxInverse(d_box_inv[ln], box_op);
+        int ierr = MatDestroy(&box_op);
         IBTK_CHKERRQ(ierr);
     }
 
@@ -737,15 +794,7 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_inv[ln].clear();
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
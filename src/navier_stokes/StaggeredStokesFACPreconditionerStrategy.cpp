@@ -39,6 +39,7 @@
 #include <utility>
 #include <vector>
 
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -158,6 +159,8 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
       d_coarse_solver_init_subclass(false),
       d_coarse_solver_type("LEVEL_SMOOTHER"),
       d_coarse_solver_default_options_prefix(default_options_prefix + "level_0_"),
+      d_coarse_solver_auto_select(true),
+      d_coarse_solver_gmg_min_cells(32768),
       d_coarse_solver_rel_residual_tol(1.0e-5),
       d_coarse_solver_abs_residual_tol(1.0e-50),
       d_coarse_solver_max_iterations(10),
@@ -201,7 +204,13 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
             d_U_restriction_method = input_db->getString("U_restriction_method");
         if (input_db->keyExists("P_restriction_method"))
             d_P_restriction_method = input_db->getString("P_restriction_method");
-        if (input_db->keyExists("coarse_solver_type")) d_coarse_solver_type = input_db->getString("coarse_solver_type");
+        if (input_db->keyExists("coarse_solver_type"))
+        {
+            d_coarse_solver_type = input_db->getString("coarse_solver_type");
+            d_coarse_solver_auto_select = false;
+        }
+        if (input_db->keyExists("coarse_solver_gmg_min_cells"))
+            d_coarse_solver_gmg_min_cells = input_db->getInteger("coarse_solver_gmg_min_cells");
         if (input_db->keyExists("coarse_solver_rel_residual_tol"))
             d_coarse_solver_rel_residual_tol = input_db->getDouble("coarse_solver_rel_residual_tol");
         if (input_db->keyExists("coarse_solver_abs_residual_tol"))
@@ -368,6 +377,13 @@ StaggeredStokesFACPreconditionerStrategy::setCoarseSolverType(const std::string&
     return;
 } // setCoarseSolverType
 
+void
+StaggeredStokesFACPreconditionerStrategy::setCoarseSolverGMGMinCells(int coarse_solver_gmg_min_cells)
+{
+    d_coarse_solver_gmg_min_cells = coarse_solver_gmg_min_cells;
+    return;
+} // setCoarseSolverGMGMinCells
+
 void
 StaggeredStokesFACPreconditionerStrategy::setCoarseSolverMaxIterations(int coarse_solver_max_iterations)
 {
@@ -736,6 +752,26 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     d_P_op_stencil_fill_pattern = new CellNoCornersFillPattern(d_gcw, false, false, false);
     d_U_synch_fill_pattern = new SideSynchCopyFillPattern();
 
+    // When the coarse level solver has not been specified, use geometric
+    // multigrid below level 0 once that level is sufficiently large.
+    if (d_coarse_solver_auto_select && !d_coarse_solver_init_subclass && coarsest_reset_ln == d_coarsest_ln)
+    {
+        Pointer<PatchLevel<NDIM> > coarsest_level = d_hierarchy->getPatchLevel(d_coarsest_ln);
+        const BoxArray<NDIM>& coarsest_boxes = coarsest_level->getBoxes();
+        int num_cells = 0;
+        for (int k = 0; k < coarsest_boxes.getNumberOfBoxes(); ++k)
+        {
+            num_cells += coarsest_boxes[k].size();
+        }
+        const std::string coarse_solver_type =
+            (d_coarse_solver_gmg_min_cells > 0 && num_cells >= d_coarse_solver_gmg_min_cells &&
+             coarsest_level->getRatio() == IntVector<NDIM>(1)) ?
+                StaggeredStokesSolverManager::GMG_LEVEL_SOLVER :
+                "LEVEL_SMOOTHER";
+        if (d_coarse_solver_type != coarse_solver_type) d_coarse_solver.setNull();
+        d_coarse_solver_type = coarse_solver_type;
+    }
+
     // Initialize the coarse level solvers when needed.
     if (!d_coarse_solver_init_subclass && coarsest_reset_ln == d_coarsest_ln &&
         d_coarse_solver_type != "LEVEL_SMOOTHER")
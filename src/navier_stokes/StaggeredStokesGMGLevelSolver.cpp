@@ -0,0 +1,521 @@
+// Filename: StaggeredStokesGMGLevelSolver.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "ProcessorMapping.h"
+#include "SAMRAIVectorReal.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "ibamr/StaggeredStokesFACPreconditioner.h"
+#include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesGMGLevelSolver.h"
+#include "ibamr/StaggeredStokesLevelRelaxationFACOperator.h"
+#include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
+#include "ibamr/StaggeredStokesSolver.h"
+#include "ibamr/StaggeredStokesSolverManager.h"
+#include "ibamr/ibamr_utilities.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CartCellDoubleCubicCoarsen.h"
+#include "ibtk/CartSideDoubleCubicCoarsen.h"
+#include "ibtk/CartSideDoubleRT0Coarsen.h"
+#include "ibtk/CartSideDoubleSpecializedConstantRefine.h"
+#include "ibtk/CartSideDoubleSpecializedLinearRefine.h"
+#include "ibtk/GeneralSolver.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+inline bool
+is_coarsenable(const BoxArray<NDIM>& boxes, const IntVector<NDIM>& ratio)
+{
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        const Box<NDIM>& box = boxes[k];
+        if (!(Box<NDIM>::refine(Box<NDIM>::coarsen(box, ratio), ratio) == box)) return false;
+    }
+    return true;
+} // is_coarsenable
+
+inline int
+num_coarsened_cells(const BoxArray<NDIM>& boxes, const IntVector<NDIM>& ratio)
+{
+    int num_cells = 0;
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        num_cells += Box<NDIM>::coarsen(boxes[k], ratio).size();
+    }
+    return num_cells;
+} // num_coarsened_cells
+
+Pointer<SAMRAIVectorReal<NDIM, double> >
+get_level_vector(const SAMRAIVectorReal<NDIM, double>& vec, const int ln)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > level_vec =
+        new SAMRAIVectorReal<NDIM, double>(vec.getName() + "::level", vec.getPatchHierarchy(), ln, ln);
+    for (int comp = 0; comp < vec.getNumberOfComponents(); ++comp)
+    {
+        level_vec->addComponent(
+            vec.getComponentVariable(comp), vec.getComponentDescriptorIndex(comp), vec.getControlVolumeIndex(comp));
+    }
+    return level_vec;
+} // get_level_vector
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+StaggeredStokesGMGLevelSolver::StaggeredStokesGMGLevelSolver(const std::string& object_name,
+                                                             Pointer<Database> input_db,
+                                                             const std::string& default_options_prefix)
+    : d_max_coarsening_levels(16),
+      d_max_coarsest_level_cells(4096),
+      d_mg_strategy(),
+      d_mg_solver(),
+      d_mg_hierarchy(),
+      d_mg_finest_ln(-1),
+      d_mg_bc_helper(),
+      d_mg_bc_coef_time(std::numeric_limits<double>::quiet_NaN()),
+      d_mg_x_idxs(),
+      d_mg_x(),
+      d_mg_b(),
+      d_mg_r(),
+      d_mg_e(),
+      d_mg_x_fine(),
+      d_mg_b_fine(),
+      d_mg_r_fine(),
+      d_mg_e_fine()
+{
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ true);
+
+    // Get values from the input database.
+    std::string U_prolongation_method = "SPECIALIZED_LINEAR_REFINE";
+    std::string P_prolongation_method = "LINEAR_REFINE";
+    std::string U_restriction_method = "RT0_COARSEN";
+    std::string P_restriction_method = "CONSERVATIVE_COARSEN";
+    if (input_db)
+    {
+        if (input_db->keyExists("max_coarsening_levels"))
+            d_max_coarsening_levels = input_db->getInteger("max_coarsening_levels");
+        if (input_db->keyExists("max_coarsest_level_cells"))
+            d_max_coarsest_level_cells = input_db->getInteger("max_coarsest_level_cells");
+        if (input_db->keyExists("U_prolongation_method"))
+            U_prolongation_method = input_db->getString("U_prolongation_method");
+        if (input_db->keyExists("P_prolongation_method"))
+            P_prolongation_method = input_db->getString("P_prolongation_method");
+        if (input_db->keyExists("U_restriction_method"))
+            U_restriction_method = input_db->getString("U_restriction_method");
+        if (input_db->keyExists("P_restriction_method"))
+            P_restriction_method = input_db->getString("P_restriction_method");
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("coarse_solver_type") &&
+            input_db->getString("coarse_solver_type") == StaggeredStokesSolverManager::GMG_LEVEL_SOLVER)
+        {
+            TBOX_ERROR(object_name << "::StaggeredStokesGMGLevelSolver():\n"
+                                   << "  the coarsest multigrid level cannot itself be solved by a "
+                                   << StaggeredStokesSolverManager::GMG_LEVEL_SOLVER << std::endl);
+        }
+    }
+
+    // Setup the multigrid preconditioner that is applied on the coarsened
+    // hierarchy.
+    d_mg_strategy = new StaggeredStokesLevelRelaxationFACOperator(
+        object_name + "::StaggeredStokesLevelRelaxationFACOperator", input_db, default_options_prefix + "mg_");
+    d_mg_strategy->setProlongationMethods(U_prolongation_method, P_prolongation_method);
+    d_mg_strategy->setRestrictionMethods(U_restriction_method, P_restriction_method);
+    d_mg_strategy->setCoarseSolverGMGMinCells(0);
+    d_mg_solver = new StaggeredStokesFACPreconditioner(
+        object_name + "::mg_solver", d_mg_strategy, input_db, default_options_prefix + "mg_");
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(
+        t_solve_system = TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesGMGLevelSolver::solveSystem()");
+        t_initialize_solver_state =
+            TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesGMGLevelSolver::initializeSolverState()");
+        t_deallocate_solver_state =
+            TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesGMGLevelSolver::deallocateSolverState()"););
+    return;
+} // StaggeredStokesGMGLevelSolver
+
+StaggeredStokesGMGLevelSolver::~StaggeredStokesGMGLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~StaggeredStokesGMGLevelSolver
+
+void
+StaggeredStokesGMGLevelSolver::setVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    d_mg_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+    return;
+} // setVelocityPoissonSpecifications
+
+void
+StaggeredStokesGMGLevelSolver::setComponentsHaveNullspace(const bool has_velocity_nullspace,
+                                                          const bool has_pressure_nullspace)
+{
+    StaggeredStokesSolver::setComponentsHaveNullspace(has_velocity_nullspace, has_pressure_nullspace);
+    d_mg_solver->setComponentsHaveNullspace(has_velocity_nullspace, has_pressure_nullspace);
+    return;
+} // setComponentsHaveNullspace
+
+void
+StaggeredStokesGMGLevelSolver::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrategy<NDIM>*>& U_bc_coefs,
+                                                  RobinBcCoefStrategy<NDIM>* P_bc_coef)
+{
+    StaggeredStokesSolver::setPhysicalBcCoefs(U_bc_coefs, P_bc_coef);
+    d_mg_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+    return;
+} // setPhysicalBcCoefs
+
+bool
+StaggeredStokesGMGLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBAMR_TIMER_START(t_solve_system);
+
+    if (d_enable_logging) plog << d_object_name << "::solveSystem():" << std::endl;
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Configure the multigrid preconditioner.
+    d_mg_solver->setSolutionTime(d_solution_time);
+    d_mg_solver->setTimeInterval(d_current_time, d_new_time);
+
+    // Update the cached boundary condition data when the solution time has
+    // changed since it was last set.
+    if (!(d_solution_time == d_mg_bc_coef_time))
+    {
+        d_mg_bc_helper->cacheBcCoefData(d_U_bc_coefs, d_solution_time, d_mg_hierarchy);
+        d_mg_bc_coef_time = d_solution_time;
+    }
+
+    // Copy the right-hand side and initial guess to the finest level of the
+    // multigrid hierarchy.
+    const int ln = x.getCoarsestLevelNumber();
+    copyLevelData(*d_mg_b, d_mg_finest_ln, b, ln);
+    if (d_initial_guess_nonzero)
+    {
+        copyLevelData(*d_mg_x, d_mg_finest_ln, x, ln);
+    }
+    else
+    {
+        d_mg_x_fine->setToScalar(0.0, /*interior_only*/ false);
+    }
+    enforceNormalVelocityBoundaryConditions(*d_mg_b, d_homogeneous_bc);
+    enforceNormalVelocityBoundaryConditions(*d_mg_x, d_homogeneous_bc);
+
+    // Apply multigrid cycles to the residual equation until the residual is
+    // sufficiently reduced.  Notice that the finest multigrid level covers the
+    // entire physical domain, so that the residual on that level only depends
+    // on data stored on that level.  The residual vanishes at Dirichlet
+    // boundaries, where the solution satisfies the boundary conditions.
+    const int residual_coarsest_ln = std::max(d_mg_finest_ln - 1, 0);
+    const double b_norm = d_mg_b_fine->L2Norm();
+    if (d_initial_guess_nonzero)
+    {
+        d_mg_strategy->computeResidual(*d_mg_r, *d_mg_x, *d_mg_b, residual_coarsest_ln, d_mg_finest_ln);
+        enforceNormalVelocityBoundaryConditions(*d_mg_r, /*homogeneous_bc*/ true);
+    }
+    else
+    {
+        d_mg_r_fine->copyVector(d_mg_b_fine, /*interior_only*/ false);
+        enforceNormalVelocityBoundaryConditions(*d_mg_r, /*homogeneous_bc*/ true);
+    }
+    d_current_iterations = 0;
+    d_current_residual_norm = d_mg_r_fine->L2Norm();
+    bool converged =
+        d_current_residual_norm <= d_abs_residual_tol || d_current_residual_norm <= d_rel_residual_tol * b_norm;
+    while (!converged && d_current_iterations < d_max_iterations)
+    {
+        d_mg_solver->solveSystem(*d_mg_e, *d_mg_r);
+        d_mg_x_fine->add(d_mg_x_fine, d_mg_e_fine);
+        enforceNormalVelocityBoundaryConditions(*d_mg_x, d_homogeneous_bc);
+        d_mg_strategy->computeResidual(*d_mg_r, *d_mg_x, *d_mg_b, residual_coarsest_ln, d_mg_finest_ln);
+        enforceNormalVelocityBoundaryConditions(*d_mg_r, /*homogeneous_bc*/ true);
+        d_current_residual_norm = d_mg_r_fine->L2Norm();
+        ++d_current_iterations;
+        converged =
+            d_current_residual_norm <= d_abs_residual_tol || d_current_residual_norm <= d_rel_residual_tol * b_norm;
+    }
+
+    // Copy the solution back to the solved level.
+    copyLevelData(x, ln, *d_mg_x, d_mg_finest_ln);
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBAMR_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+StaggeredStokesGMGLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                     const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBAMR_TIMER_START(t_initialize_solver_state);
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.getNumberOfComponents() == 2);
+    TBOX_ASSERT(b.getNumberOfComponents() == 2);
+    TBOX_ASSERT(x.getPatchHierarchy() == b.getPatchHierarchy());
+    TBOX_ASSERT(x.getCoarsestLevelNumber() == x.getFinestLevelNumber());
+    TBOX_ASSERT(b.getCoarsestLevelNumber() == x.getCoarsestLevelNumber());
+    TBOX_ASSERT(b.getFinestLevelNumber() == x.getFinestLevelNumber());
+#endif
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(x.getCoarsestLevelNumber());
+    if (!(level->getRatio() == IntVector<NDIM>(1)))
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState():\n"
+                                 << "  only levels that are not refined relative to level 0 are supported"
+                                 << std::endl);
+    }
+
+    // Determine the number of times that the level can be coarsened.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const BoxArray<NDIM>& domain_boxes = grid_geom->getPhysicalDomain();
+    int num_coarsenings = 0;
+    while (num_coarsenings < d_max_coarsening_levels &&
+           num_coarsened_cells(domain_boxes, IntVector<NDIM>(1 << num_coarsenings)) > d_max_coarsest_level_cells)
+    {
+        const IntVector<NDIM> ratio(1 << (num_coarsenings + 1));
+        if (!is_coarsenable(level_boxes, ratio) || !is_coarsenable(domain_boxes, ratio)) break;
+        ++num_coarsenings;
+    }
+    d_mg_finest_ln = num_coarsenings;
+
+    // Build the multigrid hierarchy.  Each multigrid level is obtained by
+    // coarsening the boxes of the solved level, and all levels use the same
+    // processor mapping as the solved level.
+    Pointer<CartesianGridGeometry<NDIM> > mg_grid_geom = grid_geom->makeCoarsenedGridGeometry(
+        d_object_name + "::mg_grid_geom", IntVector<NDIM>(1 << num_coarsenings), /*register_for_restart*/ false);
+    mg_grid_geom->addSpatialCoarsenOperator(new CartSideDoubleCubicCoarsen());
+    mg_grid_geom->addSpatialCoarsenOperator(new CartSideDoubleRT0Coarsen());
+    mg_grid_geom->addSpatialCoarsenOperator(new CartCellDoubleCubicCoarsen());
+    mg_grid_geom->addSpatialRefineOperator(new CartSideDoubleSpecializedConstantRefine());
+    mg_grid_geom->addSpatialRefineOperator(new CartSideDoubleSpecializedLinearRefine());
+    d_mg_hierarchy =
+        new PatchHierarchy<NDIM>(d_object_name + "::mg_hierarchy", mg_grid_geom, /*register_for_restart*/ false);
+    const ProcessorMapping& mapping = level->getProcessorMapping();
+    for (int mg_ln = 0; mg_ln <= d_mg_finest_ln; ++mg_ln)
+    {
+        BoxArray<NDIM> mg_boxes(level_boxes);
+        mg_boxes.coarsen(IntVector<NDIM>(1 << (d_mg_finest_ln - mg_ln)));
+        d_mg_hierarchy->makeNewPatchLevel(mg_ln, IntVector<NDIM>(1 << mg_ln), mg_boxes, mapping);
+    }
+
+    // Setup the multigrid vectors.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    d_mg_x = new SAMRAIVectorReal<NDIM, double>(d_object_name + "::mg_x", d_mg_hierarchy, 0, d_mg_finest_ln);
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+    {
+        const int mg_idx =
+            var_db->registerClonedPatchDataIndex(x.getComponentVariable(comp), x.getComponentDescriptorIndex(comp));
+        d_mg_x_idxs.push_back(mg_idx);
+        d_mg_x->addComponent(x.getComponentVariable(comp), mg_idx);
+    }
+    d_mg_b = d_mg_x->cloneVector(d_object_name + "::mg_b");
+    d_mg_r = d_mg_x->cloneVector(d_object_name + "::mg_r");
+    d_mg_e = d_mg_x->cloneVector(d_object_name + "::mg_e");
+    d_mg_x->allocateVectorData();
+    d_mg_b->allocateVectorData();
+    d_mg_r->allocateVectorData();
+    d_mg_e->allocateVectorData();
+    d_mg_x_fine = get_level_vector(*d_mg_x, d_mg_finest_ln);
+    d_mg_b_fine = get_level_vector(*d_mg_b, d_mg_finest_ln);
+    d_mg_r_fine = get_level_vector(*d_mg_r, d_mg_finest_ln);
+    d_mg_e_fine = get_level_vector(*d_mg_e, d_mg_finest_ln);
+
+    // Setup the physical boundary helper for the multigrid hierarchy.  The
+    // helper of the solved level cannot be used here, since it caches data
+    // that is specific to the original patch hierarchy.
+    d_mg_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+    d_mg_bc_helper->cacheBcCoefData(d_U_bc_coefs, d_solution_time, d_mg_hierarchy);
+    d_mg_bc_coef_time = d_solution_time;
+
+    // Initialize the multigrid preconditioner.
+    d_mg_solver->setSolutionTime(d_solution_time);
+    d_mg_solver->setTimeInterval(d_current_time, d_new_time);
+    d_mg_solver->setHomogeneousBc(true);
+    d_mg_solver->setVelocityPoissonSpecifications(d_U_problem_coefs);
+    d_mg_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+    d_mg_solver->setComponentsHaveNullspace(d_has_velocity_nullspace, d_has_pressure_nullspace);
+    d_mg_solver->setPhysicalBoundaryHelper(d_mg_bc_helper);
+    d_mg_solver->initializeSolverState(*d_mg_e, *d_mg_r);
+
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::initializeSolverState(): using " << d_mg_finest_ln
+             << " coarsened level(s) below level " << x.getCoarsestLevelNumber() << std::endl;
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBAMR_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+StaggeredStokesGMGLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBAMR_TIMER_START(t_deallocate_solver_state);
+
+    // Deallocate the multigrid preconditioner.
+    d_mg_solver->deallocateSolverState();
+
+    // Deallocate the multigrid vectors.
+    d_mg_x_fine.setNull();
+    d_mg_b_fine.setNull();
+    d_mg_r_fine.setNull();
+    d_mg_e_fine.setNull();
+    d_mg_b->freeVectorComponents();
+    d_mg_r->freeVectorComponents();
+    d_mg_e->freeVectorComponents();
+    d_mg_x->deallocateVectorData();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (unsigned int k = 0; k < d_mg_x_idxs.size(); ++k)
+    {
+        var_db->removePatchDataIndex(d_mg_x_idxs[k]);
+    }
+    d_mg_x_idxs.clear();
+    d_mg_x.setNull();
+    d_mg_b.setNull();
+    d_mg_r.setNull();
+    d_mg_e.setNull();
+
+    // Deallocate the physical boundary helper and the multigrid hierarchy.
+    d_mg_bc_helper->clearBcCoefData();
+    d_mg_bc_helper.setNull();
+    d_mg_bc_coef_time = std::numeric_limits<double>::quiet_NaN();
+    d_mg_hierarchy.setNull();
+    d_mg_finest_ln = -1;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBAMR_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+StaggeredStokesGMGLevelSolver::enforceNormalVelocityBoundaryConditions(SAMRAIVectorReal<NDIM, double>& v,
+                                                                       const bool homogeneous_bc)
+{
+    const int U_idx = v.getComponentDescriptorIndex(0);
+    const int P_idx = v.getComponentDescriptorIndex(1);
+    StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(d_U_bc_coefs, d_P_bc_coef, U_idx, P_idx, homogeneous_bc);
+    d_mg_bc_helper->enforceNormalVelocityBoundaryConditions(
+        U_idx, P_idx, d_U_bc_coefs, d_solution_time, homogeneous_bc, d_mg_finest_ln, d_mg_finest_ln);
+    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
+    return;
+} // enforceNormalVelocityBoundaryConditions
+
+void
+StaggeredStokesGMGLevelSolver::copyLevelData(SAMRAIVectorReal<NDIM, double>& dst,
+                                             const int dst_ln,
+                                             const SAMRAIVectorReal<NDIM, double>& src,
+                                             const int src_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getNumberOfComponents() == src.getNumberOfComponents());
+#endif
+    Pointer<PatchLevel<NDIM> > dst_level = dst.getPatchHierarchy()->getPatchLevel(dst_ln);
+    Pointer<PatchLevel<NDIM> > src_level = src.getPatchHierarchy()->getPatchLevel(src_ln);
+    for (PatchLevel<NDIM>::Iterator p(dst_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > dst_patch = dst_level->getPatch(p());
+        Pointer<Patch<NDIM> > src_patch = src_level->getPatch(p());
+        for (int comp = 0; comp < dst.getNumberOfComponents(); ++comp)
+        {
+            Pointer<PatchData<NDIM> > dst_data = dst_patch->getPatchData(dst.getComponentDescriptorIndex(comp));
+            Pointer<PatchData<NDIM> > src_data = src_patch->getPatchData(src.getComponentDescriptorIndex(comp));
+            dst_data->copy(*src_data);
+        }
+    }
+    return;
+} // copyLevelData
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
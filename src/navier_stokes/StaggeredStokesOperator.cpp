@@ -38,14 +38,21 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellVariable.h"
+#include "IBAMR_config.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "ibamr/StaggeredStokesOperator.h"
@@ -56,6 +63,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearOperator.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -63,6 +71,74 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+// FORTRAN ROUTINES
+#if (NDIM == 2)
+#define NAVIER_STOKES_STAGGERED_STOKES_OPERATOR_FC                                                                     \
+    IBAMR_FC_FUNC_(navier_stokes_staggered_stokes_operator2d, NAVIER_STOKES_STAGGERED_STOKES_OPERATOR2D)
+#endif
+
+#if (NDIM == 3)
+#define NAVIER_STOKES_STAGGERED_STOKES_OPERATOR_FC                                                                     \
+    IBAMR_FC_FUNC_(navier_stokes_staggered_stokes_operator3d, NAVIER_STOKES_STAGGERED_STOKES_OPERATOR3D)
+#endif
+
+extern "C" {
+void NAVIER_STOKES_STAGGERED_STOKES_OPERATOR_FC(const double*,
+#if (NDIM == 2)
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const double&,
+                                                const double&,
+                                                const int&,
+                                                const int&,
+                                                const double*,
+                                                const double*,
+                                                const int&,
+                                                const int&,
+                                                const double*,
+                                                const int&,
+                                                const int&,
+                                                double*,
+                                                double*,
+                                                const int&,
+                                                const int&,
+                                                double*
+#endif
+#if (NDIM == 3)
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const double&,
+                                                const double&,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const double*,
+                                                const double*,
+                                                const double*,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                const double*,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                double*,
+                                                double*,
+                                                double*,
+                                                const int&,
+                                                const int&,
+                                                const int&,
+                                                double*
+#endif
+                                                );
+}
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBAMR
@@ -255,32 +331,149 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
+    //
+    // When C and D are constant, all three terms are computed in a single sweep
+    // over each patch of each level.  The divergence on coarser levels must
+    // use coarse velocities that are synchronized with the overlying fine
+    // velocities on each coarse-fine interface, but the Laplacian must not.
+    // Thus, once all levels have been swept, the coarse-fine interfaces are
+    // synchronized in a single coarsening pass, and the divergence is
+    // recomputed on the coarser levels.  This gives the same result as
+    // computing the three terms separately.
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    const int finest_ln = x.getFinestLevelNumber();
+    const bool use_fused_kernel =
+        d_U_problem_coefs.dIsConstant() && (d_U_problem_coefs.cIsZero() || d_U_problem_coefs.cIsConstant());
+    if (use_fused_kernel)
+    {
+        const double C = d_U_problem_coefs.cIsZero() ? 0.0 : d_U_problem_coefs.getCConstant();
+        const double D = d_U_problem_coefs.getDConstant();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = x.getPatchHierarchy()->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+                const double* const dx = patch_geom->getDx();
+
+                const Box<NDIM>& patch_box = patch->getBox();
+                const IntVector<NDIM>& patch_lower = patch_box.lower();
+                const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+                Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_scratch_idx);
+                Pointer<CellData<NDIM, double> > P_data = patch->getPatchData(P_idx);
+                Pointer<SideData<NDIM, double> > A_U_data = patch->getPatchData(A_U_idx);
+                Pointer<CellData<NDIM, double> > A_P_data = patch->getPatchData(A_P_idx);
+
+                const IntVector<NDIM>& U_data_gcw = U_data->getGhostCellWidth();
+                const IntVector<NDIM>& P_data_gcw = P_data->getGhostCellWidth();
+                const IntVector<NDIM>& A_U_data_gcw = A_U_data->getGhostCellWidth();
+                const IntVector<NDIM>& A_P_data_gcw = A_P_data->getGhostCellWidth();
+
+                NAVIER_STOKES_STAGGERED_STOKES_OPERATOR_FC(dx,
+#if (NDIM == 2)
+                                                           patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           C,
+                                                           D,
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           P_data_gcw(0),
+                                                           P_data_gcw(1),
+                                                           P_data->getPointer(),
+                                                           A_U_data_gcw(0),
+                                                           A_U_data_gcw(1),
+                                                           A_U_data->getPointer(0),
+                                                           A_U_data->getPointer(1),
+                                                           A_P_data_gcw(0),
+                                                           A_P_data_gcw(1),
+                                                           A_P_data->getPointer()
+#endif
+#if (NDIM == 3)
+                                                           patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           patch_lower(2),
+                                                           patch_upper(2),
+                                                           C,
+                                                           D,
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data_gcw(2),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           U_data->getPointer(2),
+                                                           P_data_gcw(0),
+                                                           P_data_gcw(1),
+                                                           P_data_gcw(2),
+                                                           P_data->getPointer(),
+                                                           A_U_data_gcw(0),
+                                                           A_U_data_gcw(1),
+                                                           A_U_data_gcw(2),
+                                                           A_U_data->getPointer(0),
+                                                           A_U_data->getPointer(1),
+                                                           A_U_data->getPointer(2),
+                                                           A_P_data_gcw(0),
+                                                           A_P_data_gcw(1),
+                                                           A_P_data_gcw(2),
+                                                           A_P_data->getPointer()
+#endif
+                                                               );
+            }
+        }
+        if (finest_ln > coarsest_ln)
+        {
+            d_hier_math_ops->synchCoarseFineBoundary(U_scratch_idx, U_sc_var);
+            PatchMathOps patch_math_ops;
+            for (int ln = coarsest_ln; ln < finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = x.getPatchHierarchy()->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_scratch_idx);
+                    Pointer<CellData<NDIM, double> > A_P_data = patch->getPatchData(A_P_idx);
+                    patch_math_ops.div(A_P_data, -1.0, U_data, 0.0, Pointer<CellData<NDIM, double> >(NULL), patch);
+                }
+            }
+        }
+    }
+    else
+    {
+        d_hier_math_ops->grad(A_U_idx,
+                              A_U_sc_var,
+                              /*cf_bdry_synch*/ false,
+                              1.0,
+                              P_idx,
+                              P_cc_var,
+                              d_no_fill,
+                              d_new_time);
+        d_hier_math_ops->laplace(A_U_idx,
+                                 A_U_sc_var,
+                                 d_U_problem_coefs,
+                                 U_scratch_idx,
+                                 U_sc_var,
+                                 d_no_fill,
+                                 d_new_time,
+                                 1.0,
+                                 A_U_idx,
+                                 A_U_sc_var);
+        d_hier_math_ops->div(A_P_idx,
+                             A_P_cc_var,
+                             -1.0,
                              U_scratch_idx,
                              U_sc_var,
                              d_no_fill,
                              d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+                             /*cf_bdry_synch*/ true);
+    }
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
     // Deallocate scratch data.
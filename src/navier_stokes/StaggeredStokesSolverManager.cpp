@@ -42,6 +42,7 @@
 #include "ibamr/StaggeredStokesBlockFactorizationPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesGMGLevelSolver.h"
 #include "ibamr/StaggeredStokesLevelRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesOperator.h"
 #include "ibamr/StaggeredStokesPETScLevelSolver.h"
@@ -78,6 +79,7 @@ const std::string StaggeredStokesSolverManager::LEVEL_RELAXATION_FAC_PRECONDITIO
     "LEVEL_RELAXATION_FAC_PRECONDITIONER";
 const std::string StaggeredStokesSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string StaggeredStokesSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string StaggeredStokesSolverManager::GMG_LEVEL_SOLVER = "GMG_LEVEL_SOLVER";
 
 StaggeredStokesSolverManager* StaggeredStokesSolverManager::s_solver_manager_instance = NULL;
 bool StaggeredStokesSolverManager::s_registered_callback = false;
@@ -187,6 +189,7 @@ StaggeredStokesSolverManager::StaggeredStokesSolverManager() : d_solver_maker_ma
                                   StaggeredStokesLevelRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(GMG_LEVEL_SOLVER, StaggeredStokesGMGLevelSolver::allocate_solver);
     return;
 } // StaggeredStokesSolverManager
 
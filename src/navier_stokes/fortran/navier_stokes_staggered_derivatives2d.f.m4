@@ -319,3 +319,125 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply the staggered-grid Stokes operator
+c
+c         A_U = C*U + D*L*U + grad P
+c         A_P = -div U
+c
+c     in a single sweep over the patch.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_staggered_stokes_operator2d(
+     &     dx,
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     C,D,
+     &     n_U_gc0,n_U_gc1,
+     &     U0,U1,
+     &     n_P_gc0,n_P_gc1,
+     &     P,
+     &     n_A_U_gc0,n_A_U_gc1,
+     &     A_U0,A_U1,
+     &     n_A_P_gc0,n_A_P_gc1,
+     &     A_P)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+
+      INTEGER n_U_gc0,n_U_gc1
+      INTEGER n_P_gc0,n_P_gc1
+      INTEGER n_A_U_gc0,n_A_U_gc1
+      INTEGER n_A_P_gc0,n_A_P_gc1
+
+      REAL dx(0:NDIM-1)
+
+      REAL C,D
+
+      REAL U0(
+     &     SIDE2d0VECG(ifirst,ilast,n_U_gc)
+     &     )
+      REAL U1(
+     &     SIDE2d1VECG(ifirst,ilast,n_U_gc)
+     &     )
+      REAL P(
+     &     CELL2dVECG(ifirst,ilast,n_P_gc)
+     &     )
+c
+c     Output.
+c
+      REAL A_U0(
+     &     SIDE2d0VECG(ifirst,ilast,n_A_U_gc)
+     &     )
+      REAL A_U1(
+     &     SIDE2d1VECG(ifirst,ilast,n_A_U_gc)
+     &     )
+      REAL A_P(
+     &     CELL2dVECG(ifirst,ilast,n_A_P_gc)
+     &     )
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL lfac0,lfac1,gfac0,gfac1,dfac0,dfac1
+c
+c     The coefficients and the order of operations are the same as those
+c     used by the separate side-centered Laplacian, gradient, and
+c     divergence kernels.
+c
+      lfac0 = D/(dx(0)*dx(0))
+      lfac1 = D/(dx(1)*dx(1))
+      gfac0 = 1.d0/dx(0)
+      gfac1 = 1.d0/dx(1)
+      dfac0 = -1.d0/dx(0)
+      dfac1 = -1.d0/dx(1)
+c
+c     Compute the values associated with each cell and its lower sides.
+c
+      do i1 = ifirst1,ilast1
+         do i0 = ifirst0,ilast0
+            A_U0(i0,i1) =
+     &           lfac0*(U0(i0-1,i1)+U0(i0+1,i1)-2.d0*U0(i0,i1)) +
+     &           lfac1*(U0(i0,i1-1)+U0(i0,i1+1)-2.d0*U0(i0,i1)) +
+     &           C*U0(i0,i1)                                    +
+     &           gfac0*(P(i0,i1)-P(i0-1,i1))
+            A_U1(i0,i1) =
+     &           lfac0*(U1(i0-1,i1)+U1(i0+1,i1)-2.d0*U1(i0,i1)) +
+     &           lfac1*(U1(i0,i1-1)+U1(i0,i1+1)-2.d0*U1(i0,i1)) +
+     &           C*U1(i0,i1)                                    +
+     &           gfac1*(P(i0,i1)-P(i0,i1-1))
+            A_P(i0,i1) =
+     &           dfac0*(U0(i0+1,i1)-U0(i0,i1)) +
+     &           dfac1*(U1(i0,i1+1)-U1(i0,i1))
+         enddo
+      enddo
+c
+c     Compute the values on the upper sides of the patch.
+c
+      i0 = ilast0+1
+      do i1 = ifirst1,ilast1
+         A_U0(i0,i1) =
+     &        lfac0*(U0(i0-1,i1)+U0(i0+1,i1)-2.d0*U0(i0,i1)) +
+     &        lfac1*(U0(i0,i1-1)+U0(i0,i1+1)-2.d0*U0(i0,i1)) +
+     &        C*U0(i0,i1)                                    +
+     &        gfac0*(P(i0,i1)-P(i0-1,i1))
+      enddo
+
+      i1 = ilast1+1
+      do i0 = ifirst0,ilast0
+         A_U1(i0,i1) =
+     &        lfac0*(U1(i0-1,i1)+U1(i0+1,i1)-2.d0*U1(i0,i1)) +
+     &        lfac1*(U1(i0,i1-1)+U1(i0,i1+1)-2.d0*U1(i0,i1)) +
+     &        C*U1(i0,i1)                                    +
+     &        gfac1*(P(i0,i1)-P(i0,i1-1))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
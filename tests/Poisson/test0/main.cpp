@@ -0,0 +1,236 @@
+// Filename: main.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+/*******************************************************************************
+ * This test solves a periodic Poisson problem with a manufactured solution    *
+ * using the cell-centered and side-centered FFT level solvers.  The test      *
+ * fails if the residual of the discrete system is not at round-off level, or  *
+ * if the discretization error exceeds the specified tolerance.  The command   *
+ * line is:                                                                    *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "poisson_fft.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double error_tol = input_db->getDouble("ERROR_TOL");
+        const double residual_tol = input_db->getDouble("RESIDUAL_TOL");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > e_sc_var = new SideVariable<NDIM, double>("e_sc");
+        Pointer<SideVariable<NDIM, double> > r_sc_var = new SideVariable<NDIM, double>("r_sc");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int e_sc_idx = var_db->registerVariableAndContext(e_sc_var, ctx, IntVector<NDIM>(1));
+        const int r_sc_idx = var_db->registerVariableAndContext(r_sc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the patch hierarchy, which consists of a single level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        TBOX_ASSERT(patch_hierarchy->getFinestLevelNumber() == 0);
+
+        // Allocate data on the patch hierarchy.
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_cc_idx, 0.0);
+        level->allocatePatchData(f_cc_idx, 0.0);
+        level->allocatePatchData(e_cc_idx, 0.0);
+        level->allocatePatchData(r_cc_idx, 0.0);
+        level->allocatePatchData(u_sc_idx, 0.0);
+        level->allocatePatchData(f_sc_idx, 0.0);
+        level->allocatePatchData(e_sc_idx, 0.0);
+        level->allocatePatchData(r_sc_idx, 0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_cc_vec("e_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> r_cc_vec("r_cc", patch_hierarchy, 0, 0);
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_cc_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        r_cc_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_sc_vec("e_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> r_sc_vec("r_sc", patch_hierarchy, 0, 0);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        e_sc_vec.addComponent(e_sc_var, e_sc_idx, h_sc_idx);
+        r_sc_vec.addComponent(r_sc_var, r_sc_idx, h_sc_idx);
+
+        // Setup the exact solution and the right-hand side.  The exact solution
+        // has zero mean, so that it is also the solution of the discrete
+        // problem with the zero mode removed.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(e_cc_idx, e_cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(e_sc_idx, e_sc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+
+        // Solve -L*u = f.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCLaplaceOperator cc_laplace_op("cc_laplace_op");
+        cc_laplace_op.setPoissonSpecifications(poisson_spec);
+        cc_laplace_op.setPhysicalBcCoef(bc_coef);
+        cc_laplace_op.initializeOperatorState(u_cc_vec, f_cc_vec);
+        Pointer<PoissonSolver> cc_poisson_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+            CCPoissonSolverManager::FFT_LEVEL_SOLVER, "cc_poisson_solver", solver_db, "cc_");
+        cc_poisson_solver->setPoissonSpecifications(poisson_spec);
+        cc_poisson_solver->setPhysicalBcCoef(bc_coef);
+        cc_poisson_solver->initializeSolverState(u_cc_vec, f_cc_vec);
+        cc_poisson_solver->solveSystem(u_cc_vec, f_cc_vec);
+
+        vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        SCLaplaceOperator sc_laplace_op("sc_laplace_op");
+        sc_laplace_op.setPoissonSpecifications(poisson_spec);
+        sc_laplace_op.setPhysicalBcCoefs(bc_coefs);
+        sc_laplace_op.initializeOperatorState(u_sc_vec, f_sc_vec);
+        Pointer<PoissonSolver> sc_poisson_solver = SCPoissonSolverManager::getManager()->allocateSolver(
+            SCPoissonSolverManager::FFT_LEVEL_SOLVER, "sc_poisson_solver", solver_db, "sc_");
+        sc_poisson_solver->setPoissonSpecifications(poisson_spec);
+        sc_poisson_solver->setPhysicalBcCoefs(bc_coefs);
+        sc_poisson_solver->initializeSolverState(u_sc_vec, f_sc_vec);
+        sc_poisson_solver->solveSystem(u_sc_vec, f_sc_vec);
+
+        // Compute the error and residual norms.
+        e_cc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_cc_vec, false),
+                          Pointer<SAMRAIVectorReal<NDIM, double> >(&u_cc_vec, false));
+        cc_laplace_op.apply(u_cc_vec, r_cc_vec);
+        r_cc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_cc_vec, false),
+                          Pointer<SAMRAIVectorReal<NDIM, double> >(&r_cc_vec, false));
+        const double e_cc_norm = e_cc_vec.maxNorm();
+        const double r_cc_norm = r_cc_vec.maxNorm() / f_cc_vec.maxNorm();
+        pout << "cell-centered solver:\n"
+             << "  |e|_oo = " << e_cc_norm << "\n"
+             << "  |r|_oo / |f|_oo = " << r_cc_norm << "\n";
+
+        e_sc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_sc_vec, false),
+                          Pointer<SAMRAIVectorReal<NDIM, double> >(&u_sc_vec, false));
+        sc_laplace_op.apply(u_sc_vec, r_sc_vec);
+        r_sc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_sc_vec, false),
+                          Pointer<SAMRAIVectorReal<NDIM, double> >(&r_sc_vec, false));
+        const double e_sc_norm = e_sc_vec.maxNorm();
+        const double r_sc_norm = r_sc_vec.maxNorm() / f_sc_vec.maxNorm();
+        pout << "side-centered solver:\n"
+             << "  |e|_oo = " << e_sc_norm << "\n"
+             << "  |r|_oo / |f|_oo = " << r_sc_norm << "\n";
+
+        test_passed = e_cc_norm <= error_tol && r_cc_norm <= residual_tol && e_sc_norm <= error_tol &&
+                      r_sc_norm <= residual_tol;
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
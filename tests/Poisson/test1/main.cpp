@@ -0,0 +1,240 @@
+// Filename: main.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+/*******************************************************************************
+ * This test solves a Poisson problem with a manufactured solution on a        *
+ * two-level locally refined grid whose fine level has a concave corner.  The  *
+ * composite-grid problem is solved by a Krylov method preconditioned by FAC,  *
+ * by the same Krylov method preconditioned by the hypre composite-grid        *
+ * solver, and by the hypre composite-grid solver alone.  The test fails if    *
+ * the FAC solution does not approximate the exact solution, if the solution   *
+ * obtained with the hypre preconditioner does not agree with the FAC          *
+ * solution to solver tolerance, or if the solution obtained with the hypre    *
+ * solver alone does not agree with the FAC solution to discretization         *
+ * accuracy.  The command line is:                                             *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "poisson_composite.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double error_tol = input_db->getDouble("ERROR_TOL");
+        const double solver_tol = input_db->getDouble("SOLVER_TOL");
+        const double discretization_tol = input_db->getDouble("DISCRETIZATION_TOL");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_fac_var = new CellVariable<NDIM, double>("u_fac");
+        Pointer<CellVariable<NDIM, double> > u_krylov_var = new CellVariable<NDIM, double>("u_krylov");
+        Pointer<CellVariable<NDIM, double> > u_hypre_var = new CellVariable<NDIM, double>("u_hypre");
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f");
+        Pointer<CellVariable<NDIM, double> > e_var = new CellVariable<NDIM, double>("e");
+        const int u_fac_idx = var_db->registerVariableAndContext(u_fac_var, ctx, IntVector<NDIM>(1));
+        const int u_krylov_idx = var_db->registerVariableAndContext(u_krylov_var, ctx, IntVector<NDIM>(1));
+        const int u_hypre_idx = var_db->registerVariableAndContext(u_hypre_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int e_idx = var_db->registerVariableAndContext(e_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        TBOX_ASSERT(finest_ln == 1);
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_fac_idx, 0.0);
+            level->allocatePatchData(u_krylov_idx, 0.0);
+            level->allocatePatchData(u_hypre_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(e_idx, 0.0);
+        }
+
+        // Setup vector objects.  The cell weights vanish on covered cells, so
+        // that norms only include the composite-grid values.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_fac_vec("u_fac", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_krylov_vec("u_krylov", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_hypre_vec("u_hypre", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, finest_ln);
+        u_fac_vec.addComponent(u_fac_var, u_fac_idx, h_idx);
+        u_krylov_vec.addComponent(u_krylov_var, u_krylov_idx, h_idx);
+        u_hypre_vec.addComponent(u_hypre_var, u_hypre_idx, h_idx);
+        f_vec.addComponent(f_var, f_idx, h_idx);
+        e_vec.addComponent(e_var, e_idx, h_idx);
+
+        // Setup the exact solution and the right-hand side.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(e_idx, e_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+
+        // Solve -L*u = f with homogeneous Dirichlet boundary conditions.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCPoissonSolverManager* solver_manager = CCPoissonSolverManager::getManager();
+
+        Pointer<PoissonSolver> fac_solver =
+            solver_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                           "fac_solver",
+                                           input_db->getDatabase("krylov_solver_db"),
+                                           "fac_",
+                                           CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                           "fac_precond",
+                                           input_db->getDatabase("fac_precond_db"),
+                                           "fac_pc_");
+        fac_solver->setPoissonSpecifications(poisson_spec);
+        fac_solver->setPhysicalBcCoef(bc_coef);
+        fac_solver->initializeSolverState(u_fac_vec, f_vec);
+        fac_solver->solveSystem(u_fac_vec, f_vec);
+
+        Pointer<PoissonSolver> krylov_solver =
+            solver_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                           "krylov_solver",
+                                           input_db->getDatabase("krylov_solver_db"),
+                                           "krylov_",
+                                           CCPoissonSolverManager::HYPRE_COMPOSITE_SOLVER,
+                                           "hypre_precond",
+                                           input_db->getDatabase("hypre_precond_db"),
+                                           "hypre_pc_");
+        krylov_solver->setPoissonSpecifications(poisson_spec);
+        krylov_solver->setPhysicalBcCoef(bc_coef);
+        krylov_solver->initializeSolverState(u_krylov_vec, f_vec);
+        krylov_solver->solveSystem(u_krylov_vec, f_vec);
+
+        Pointer<PoissonSolver> hypre_solver =
+            solver_manager->allocateSolver(CCPoissonSolverManager::HYPRE_COMPOSITE_SOLVER,
+                                           "hypre_solver",
+                                           input_db->getDatabase("hypre_solver_db"),
+                                           "hypre_");
+        hypre_solver->setPoissonSpecifications(poisson_spec);
+        hypre_solver->setPhysicalBcCoef(bc_coef);
+        hypre_solver->initializeSolverState(u_hypre_vec, f_vec);
+        hypre_solver->solveSystem(u_hypre_vec, f_vec);
+
+        // Compute the error of the FAC solution and the differences between
+        // the solutions.
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_fac_vec, false));
+        const double e_fac_norm = e_vec.maxNorm();
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_krylov_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_fac_vec, false));
+        const double d_krylov_norm = e_vec.maxNorm();
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_hypre_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_fac_vec, false));
+        const double d_hypre_norm = e_vec.maxNorm();
+        pout << "FAC-preconditioned solver:\n"
+             << "  |u_exact - u_fac|_oo = " << e_fac_norm << "\n"
+             << "hypre-preconditioned solver:\n"
+             << "  |u_krylov - u_fac|_oo = " << d_krylov_norm << "\n"
+             << "hypre composite-grid solver:\n"
+             << "  |u_hypre - u_fac|_oo = " << d_hypre_norm << "\n";
+
+        test_passed = e_fac_norm <= error_tol && d_krylov_norm <= solver_tol && d_hypre_norm <= discretization_tol;
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
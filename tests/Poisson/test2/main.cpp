@@ -0,0 +1,209 @@
+// Filename: main.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+/*******************************************************************************
+ * This test solves a Poisson problem with a manufactured solution on a        *
+ * three-level locally refined grid, so that the intermediate level has        *
+ * coarse-fine interfaces.  The composite-grid problem is solved by FGMRES     *
+ * preconditioned by FAC with V-cycles and with K-cycles.  The test fails if   *
+ * either solve does not converge, if the K-cycle solve does not take fewer    *
+ * iterations than the V-cycle solve, or if the two solutions do not agree to  *
+ * solver tolerance.  The command line is:                                     *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "k_cycle.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double solver_tol = input_db->getDouble("SOLVER_TOL");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_v_var = new CellVariable<NDIM, double>("u_v");
+        Pointer<CellVariable<NDIM, double> > u_k_var = new CellVariable<NDIM, double>("u_k");
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f");
+        Pointer<CellVariable<NDIM, double> > e_var = new CellVariable<NDIM, double>("e");
+        const int u_v_idx = var_db->registerVariableAndContext(u_v_var, ctx, IntVector<NDIM>(1));
+        const int u_k_idx = var_db->registerVariableAndContext(u_k_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int e_idx = var_db->registerVariableAndContext(e_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        TBOX_ASSERT(finest_ln == 2);
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_v_idx, 0.0);
+            level->allocatePatchData(u_k_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(e_idx, 0.0);
+        }
+
+        // Setup vector objects.  The cell weights vanish on covered cells, so
+        // that norms only include the composite-grid values.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_v_vec("u_v", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_k_vec("u_k", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, finest_ln);
+        u_v_vec.addComponent(u_v_var, u_v_idx, h_idx);
+        u_k_vec.addComponent(u_k_var, u_k_idx, h_idx);
+        f_vec.addComponent(f_var, f_idx, h_idx);
+        e_vec.addComponent(e_var, e_idx, h_idx);
+
+        // Setup the right-hand side.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+
+        // Solve -L*u = f with homogeneous Dirichlet boundary conditions, first
+        // with V-cycles and then with K-cycles.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCPoissonSolverManager* solver_manager = CCPoissonSolverManager::getManager();
+        Pointer<Database> krylov_solver_db = input_db->getDatabase("krylov_solver_db");
+        Pointer<Database> fac_precond_db = input_db->getDatabase("fac_precond_db");
+        const int max_iterations = krylov_solver_db->getInteger("max_iterations");
+
+        const std::string cycle_types[2] = { "V_CYCLE", "K_CYCLE" };
+        SAMRAIVectorReal<NDIM, double>* const u_vecs[2] = { &u_v_vec, &u_k_vec };
+        int num_iterations[2];
+        for (int k = 0; k < 2; ++k)
+        {
+            fac_precond_db->putString("cycle_type", cycle_types[k]);
+            Pointer<PoissonSolver> solver =
+                solver_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                               "solver_" + cycle_types[k],
+                                               krylov_solver_db,
+                                               "",
+                                               CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                               "precond_" + cycle_types[k],
+                                               fac_precond_db,
+                                               "");
+            solver->setPoissonSpecifications(poisson_spec);
+            solver->setPhysicalBcCoef(bc_coef);
+            solver->initializeSolverState(*u_vecs[k], f_vec);
+            solver->solveSystem(*u_vecs[k], f_vec);
+            Pointer<LinearSolver> linear_solver = solver;
+            num_iterations[k] = linear_solver->getNumIterations();
+            pout << cycle_types[k] << ": " << num_iterations[k] << " FGMRES iterations\n";
+            solver->deallocateSolverState();
+        }
+
+        // Compare the solutions.
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_k_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_v_vec, false));
+        const double d_norm = e_vec.maxNorm();
+        pout << "|u_k_cycle - u_v_cycle|_oo = " << d_norm << "\n";
+
+        test_passed =
+            num_iterations[0] < max_iterations && num_iterations[1] < num_iterations[0] && d_norm <= solver_tol;
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
@@ -0,0 +1,172 @@
+// Filename: main.cpp
+// Created on 18 Oct 2026
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscksp.h>
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PETScKrylovRecycleSpace.h>
+
+/*******************************************************************************
+ * This test solves a sequence of implicit diffusion problems                  *
+ * (I/dt - L) u = f, with L the standard one-dimensional Laplacian on the unit *
+ * interval, using a time step size dt that changes before each solve.  The    *
+ * initial guesses are formed by PETScKrylovRecycleSpace.  The test fails if   *
+ * the projected residual norm of an initial guess differs from its true       *
+ * residual norm, or if the projection increases the residual norm.  The       *
+ * command line is:                                                            *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "krylov_recycle_space.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double residual_tol = input_db->getDouble("RESIDUAL_TOL");
+        const int N = input_db->getInteger("N");
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const double dt_initial = input_db->getDouble("DT_INITIAL");
+        const double dt_growth = input_db->getDouble("DT_GROWTH");
+        const int recycle_size = input_db->getInteger("RECYCLE_SIZE");
+        const double h = 1.0 / static_cast<double>(N);
+
+        // Setup the Laplacian with homogeneous Dirichlet boundary conditions.
+        Mat L;
+        MatCreateAIJ(PETSC_COMM_WORLD, PETSC_DECIDE, PETSC_DECIDE, N, N, 3, NULL, 2, NULL, &L);
+        int i_lower, i_upper;
+        MatGetOwnershipRange(L, &i_lower, &i_upper);
+        for (int i = i_lower; i < i_upper; ++i)
+        {
+            const int cols[3] = { i - 1, i, i + 1 };
+            const double vals[3] = { 1.0 / (h * h), -2.0 / (h * h), 1.0 / (h * h) };
+            const int offset = (i == 0 ? 1 : 0);
+            const int num_cols = 3 - offset - (i == N - 1 ? 1 : 0);
+            MatSetValues(L, 1, &i, num_cols, &cols[offset], &vals[offset], INSERT_VALUES);
+        }
+        MatAssemblyBegin(L, MAT_FINAL_ASSEMBLY);
+        MatAssemblyEnd(L, MAT_FINAL_ASSEMBLY);
+
+        Mat A;
+        MatDuplicate(L, MAT_DO_NOT_COPY_VALUES, &A);
+        Vec x, b, r;
+        MatCreateVecs(A, &x, &b);
+        VecDuplicate(b, &r);
+
+        KSP ksp;
+        KSPCreate(PETSC_COMM_WORLD, &ksp);
+        KSPSetType(ksp, KSPCG);
+        KSPSetTolerances(ksp, 1.0e-10, 1.0e-50, PETSC_DEFAULT, 10 * N);
+        KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);
+
+        PETScKrylovRecycleSpace recycle_space;
+        recycle_space.setMaxSize(recycle_size);
+
+        double dt = dt_initial;
+        for (int step = 0; step < num_steps; ++step, dt *= dt_growth)
+        {
+            // Form A = I/dt - L for the current time step size.
+            MatCopy(L, A, SAME_NONZERO_PATTERN);
+            MatScale(A, -1.0);
+            MatShift(A, 1.0 / dt);
+            KSPSetOperators(ksp, A, A);
+
+            // Form a right-hand side that varies slowly between the solves.
+            for (int i = i_lower; i < i_upper; ++i)
+            {
+                const double X = (static_cast<double>(i) + 0.5) * h;
+                const double val = sin(M_PI * X) + 0.1 * static_cast<double>(step) * sin(2.0 * M_PI * X);
+                VecSetValue(b, i, val, INSERT_VALUES);
+            }
+            VecAssemblyBegin(b);
+            VecAssemblyEnd(b);
+
+            // Form the initial guess and compare the projected residual norm
+            // to the true residual norm.
+            recycle_space.formInitialGuess(A, x, b, /*initial_guess_nonzero*/ false);
+            MatMult(A, x, r);
+            VecAYPX(r, -1.0, b);
+            double r_norm;
+            VecNorm(r, NORM_2, &r_norm);
+            const double r0_norm = recycle_space.getInitialResidualNorm();
+            const double r_proj_norm = recycle_space.getProjectedResidualNorm();
+            const bool step_passed =
+                fabs(r_proj_norm - r_norm) <= residual_tol * r0_norm && r_proj_norm <= r0_norm;
+            test_passed = test_passed && step_passed;
+
+            // Solve the system and add the correction to the recycle space.
+            KSPSolve(ksp, b, x);
+            int num_iterations;
+            KSPGetIterationNumber(ksp, &num_iterations);
+            recycle_space.update(A, x);
+
+            pout << "step " << step << ": dt = " << dt << ", recycle space size = " << recycle_space.getSize()
+                 << ", |r_0| = " << r0_norm << ", projected |r| = " << r_proj_norm << ", true |r| = " << r_norm
+                 << ", CG iterations = " << num_iterations << (step_passed ? "" : " (FAILED)") << "\n";
+        }
+
+        recycle_space.reset();
+        KSPDestroy(&ksp);
+        VecDestroy(&x);
+        VecDestroy(&b);
+        VecDestroy(&r);
+        MatDestroy(&A);
+        MatDestroy(&L);
+
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main